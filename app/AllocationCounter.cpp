@@ -0,0 +1,109 @@
+/*
+ * @file        AllocationCounter.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file AllocationCounter.cpp contains the definitions for AllocationCounter and
+ *              AllocationScope classes
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "../include/AllocationCounter.h"
+
+const bool AllocationCounter::kIsEnabled;
+
+namespace {
+
+/*! \brief Counts of the process */
+std::atomic<std::uint64_t> total_allocations{0};
+std::atomic<std::uint64_t> total_deallocations{0};
+std::atomic<std::uint64_t> total_bytes{0};
+std::atomic<std::int64_t> total_live_bytes{0};
+std::atomic<std::int64_t> total_peak_live_bytes{0};
+
+}  // namespace
+
+AllocationStats &AllocationCounter::Local() {
+    thread_local AllocationStats counters;
+    return counters;
+}
+
+void AllocationCounter::CountAllocation(const std::size_t &bytes) {
+    const auto size = static_cast<std::int64_t>(bytes);
+    AllocationStats &counters = Local();
+    counters.allocations++;
+    counters.bytes += bytes;
+    counters.live_bytes += size;
+    counters.peak_live_bytes = std::max(counters.peak_live_bytes, counters.live_bytes);
+
+    total_allocations.fetch_add(1, std::memory_order_relaxed);
+    total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    const std::int64_t live = total_live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::int64_t peak = total_peak_live_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !total_peak_live_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void AllocationCounter::CountDeallocation(const std::size_t &bytes) {
+    AllocationStats &counters = Local();
+    counters.deallocations++;
+    counters.live_bytes -= static_cast<std::int64_t>(bytes);
+    total_deallocations.fetch_add(1, std::memory_order_relaxed);
+    total_live_bytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+}
+
+AllocationStats AllocationCounter::get_totals() {
+    AllocationStats stats;
+    stats.allocations = total_allocations.load(std::memory_order_relaxed);
+    stats.deallocations = total_deallocations.load(std::memory_order_relaxed);
+    stats.bytes = total_bytes.load(std::memory_order_relaxed);
+    stats.live_bytes = total_live_bytes.load(std::memory_order_relaxed);
+    stats.peak_live_bytes = total_peak_live_bytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+AllocationScope::AllocationScope() : start_{AllocationCounter::Local()} {
+    // The thread peak restarts from the live bytes, and is restored on exit
+    AllocationStats &counters = AllocationCounter::Local();
+    outer_peak_ = counters.peak_live_bytes;
+    counters.peak_live_bytes = counters.live_bytes;
+}
+
+AllocationScope::~AllocationScope() {
+    AllocationStats &counters = AllocationCounter::Local();
+    counters.peak_live_bytes = std::max(counters.peak_live_bytes, outer_peak_);
+}
+
+AllocationStats AllocationScope::get_stats() const {
+    const AllocationStats &counters = AllocationCounter::Local();
+    AllocationStats stats;
+    stats.allocations = counters.allocations - start_.allocations;
+    stats.deallocations = counters.deallocations - start_.deallocations;
+    stats.bytes = counters.bytes - start_.bytes;
+    stats.live_bytes = counters.live_bytes - start_.live_bytes;
+    stats.peak_live_bytes = counters.peak_live_bytes - start_.live_bytes;
+    return stats;
+}
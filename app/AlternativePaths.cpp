@@ -0,0 +1,294 @@
+/*
+ * @file        AlternativePaths.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file AlternativePaths.cpp contains the definitions for AlternativePaths class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "../include/AlternativePaths.h"
+#include "../include/BitGrid.h"
+#include "../include/Path.h"
+
+namespace {
+
+/*! \brief Weight of the cost to come in the priority of A*, which breaks ties between
+ * equal totals in favour of the deepest cell, so that a search along the tree of the BFS
+ * goes straight to the goal */
+const double kDepthTieBreak = 1e-9;
+
+}  // namespace
+
+int AlternativePaths::FindShortest(const std::pair<int, int> &start, const std::pair<int, int> &goal, const int &k,
+                                   std::vector<Path> &paths) {
+    paths.clear();
+    expansions_ = 0;
+    accepted_.clear();
+    deviation_.clear();
+    candidates_.clear();
+    if (k < 1 || !Prepare(start, goal))
+        return 0;
+
+    // The shortest path goes down the tree of the BFS
+    std::vector<int> cells{grid_.ToIndex(start)};
+    while (cells.back() != goal_) {
+        const std::pair<int, int> node = grid_.ToNode(cells.back());
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (grid_.IsWithinRegion(next) && to_goal_[grid_.ToIndex(next)] == to_goal_[cells.back()] - 1) {
+                cells.push_back(grid_.ToIndex(next));
+                break;
+            }
+        }
+    }
+
+    // Candidates by length, the searched ones first since their length is exact, then
+    // by index
+    using Entry = std::tuple<int, bool, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    int deviation = 0;
+    while (true) {
+        const int path = static_cast<int>(accepted_.size());
+        accepted_.push_back(std::move(cells));
+        deviation_.push_back(deviation);
+        const std::vector<int> &accepted = accepted_.back();
+        if (static_cast<int>(accepted_.size()) == k)
+            break;
+
+        // Branches at the nodes from the deviation on, the prefix growing by one cell
+        // each time; a branch may not take the next move of any path sharing its prefix
+        std::vector<std::size_t> common(accepted_.size());
+        for (std::size_t q = 0; q < accepted_.size(); q++) {
+            const std::vector<int> &other = accepted_[q];
+            const std::size_t size = std::min(other.size(), accepted.size());
+            common[q] = static_cast<std::size_t>(
+                    std::mismatch(other.begin(), other.begin() + size, accepted.begin()).first - other.begin());
+        }
+        if (++epoch_ == 0) {
+            std::fill(blocked_.begin(), blocked_.end(), 0);
+            epoch_ = 1;
+        }
+        for (int i = 0; i < deviation; i++)
+            blocked_[accepted[i]] = epoch_;
+        for (int i = deviation; i + 1 < static_cast<int>(accepted.size()); i++) {
+            forbidden_.clear();
+            for (std::size_t q = 0; q < accepted_.size(); q++) {
+                if (common[q] > static_cast<std::size_t>(i) && accepted_[q].size() > static_cast<std::size_t>(i) + 1)
+                    forbidden_.push_back(accepted_[q][i + 1]);
+            }
+            const int bound = Bound(path, i);
+            if (bound >= 0) {
+                candidates_.push_back(Candidate{bound, path, i, false, {}});
+                queue.emplace(bound, true, static_cast<int>(candidates_.size()) - 1);
+            }
+            blocked_[accepted[i]] = epoch_;
+        }
+
+        // Searches the branches in order of their bounds until the best one is exact
+        bool is_found = false;
+        while (!queue.empty() && !is_found) {
+            const int index = std::get<2>(queue.top());
+            queue.pop();
+            Candidate &candidate = candidates_[index];
+            if (candidate.is_searched) {
+                cells = std::move(candidate.cells);
+                deviation = candidate.spur;
+                is_found = true;
+                break;
+            }
+            Restrict(candidate.path, candidate.spur);
+            std::vector<int> branch;
+            if (!Search(accepted_[candidate.path][candidate.spur], branch))
+                continue;
+            const std::vector<int> &parent = accepted_[candidate.path];
+            candidate.cells.assign(parent.begin(), parent.begin() + candidate.spur);
+            candidate.cells.insert(candidate.cells.end(), branch.begin(), branch.end());
+            candidate.length = static_cast<int>(candidate.cells.size()) - 1;
+            candidate.is_searched = true;
+            queue.emplace(candidate.length, false, index);
+        }
+        if (!is_found)
+            break;
+    }
+    paths.resize(accepted_.size());
+    for (std::size_t i = 0; i < accepted_.size(); i++)
+        ToPath(accepted_[i], paths[i]);
+    return static_cast<int>(paths.size());
+}
+
+int AlternativePaths::FindDiverse(const std::pair<int, int> &start, const std::pair<int, int> &goal, const int &k,
+                                  std::vector<Path> &paths, const double &penalty, const double &max_stretch) {
+    paths.clear();
+    expansions_ = 0;
+    accepted_.clear();
+    if (k < 1 || !Prepare(start, goal))
+        return 0;
+    if (++epoch_ == 0) {
+        std::fill(blocked_.begin(), blocked_.end(), 0);
+        epoch_ = 1;
+    }
+    forbidden_.clear();
+
+    // A search which finds a route already accepted only raises the penalties, so the
+    // number of searches is bounded in case the penalty cannot push the routes apart
+    const int start_cell = grid_.ToIndex(start);
+    const double longest = max_stretch * to_goal_[start_cell];
+    std::vector<int> cells;
+    for (int tries = 0; static_cast<int>(accepted_.size()) < k && tries < 4 * k; tries++) {
+        Search(start_cell, cells);
+        if (static_cast<double>(cells.size() - 1) > longest)
+            break;
+        if (std::find(accepted_.begin(), accepted_.end(), cells) == accepted_.end())
+            accepted_.push_back(cells);
+        for (const int &cell : cells) {
+            if (penalty_[cell] == 0)
+                penalized_.push_back(cell);
+            penalty_[cell] += penalty;
+        }
+    }
+    paths.resize(accepted_.size());
+    for (std::size_t i = 0; i < accepted_.size(); i++)
+        ToPath(accepted_[i], paths[i]);
+    return static_cast<int>(paths.size());
+}
+
+bool AlternativePaths::Prepare(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return false;
+    const std::size_t cell_count = static_cast<std::size_t>(grid_.get_cell_count());
+    if (blocked_.size() != cell_count) {
+        blocked_.assign(cell_count, 0);
+        penalty_.assign(cell_count, 0);
+        penalized_.clear();
+        epoch_ = 0;
+    }
+    for (const int &cell : penalized_)
+        penalty_[cell] = 0;
+    penalized_.clear();
+    goal_ = grid_.ToIndex(goal);
+    to_goal_.assign(cell_count, -1);
+    std::vector<int> queue{goal_};
+    to_goal_[goal_] = 0;
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        const std::pair<int, int> node = grid_.ToNode(queue[head]);
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int cell = grid_.ToIndex(next);
+            if (to_goal_[cell] < 0) {
+                to_goal_[cell] = to_goal_[queue[head]] + 1;
+                queue.push_back(cell);
+            }
+        }
+    }
+    return to_goal_[grid_.ToIndex(start)] >= 0;
+}
+
+void AlternativePaths::Restrict(const int &path, const int &spur) {
+    const std::vector<int> &cells = accepted_[path];
+    if (++epoch_ == 0) {
+        std::fill(blocked_.begin(), blocked_.end(), 0);
+        epoch_ = 1;
+    }
+    for (int i = 0; i < spur; i++)
+        blocked_[cells[i]] = epoch_;
+    forbidden_.clear();
+    for (const std::vector<int> &other : accepted_) {
+        if (other.size() > static_cast<std::size_t>(spur) + 1 &&
+            std::equal(cells.begin(), cells.begin() + spur + 1, other.begin()))
+            forbidden_.push_back(other[spur + 1]);
+    }
+}
+
+int AlternativePaths::Bound(const int &path, const int &spur) const {
+    const std::pair<int, int> node = grid_.ToNode(accepted_[path][spur]);
+    int bound = -1;
+    for (int d = 0; d < 4; d++) {
+        const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+        if (!grid_.IsWithinRegion(next))
+            continue;
+        const int cell = grid_.ToIndex(next);
+        if (to_goal_[cell] < 0 || blocked_[cell] == epoch_ ||
+            std::find(forbidden_.begin(), forbidden_.end(), cell) != forbidden_.end())
+            continue;
+        if (bound < 0 || spur + 1 + to_goal_[cell] < bound)
+            bound = spur + 1 + to_goal_[cell];
+    }
+    return bound;
+}
+
+bool AlternativePaths::Search(const int &from, std::vector<int> &cells) {
+    cells.clear();
+    workspace_.Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    workspace_.Update(from, 0, from);
+    workspace_.Push(to_goal_[from], from);
+    while (!workspace_.IsEmpty()) {
+        const HeapEntry entry = workspace_.Pop();
+        if (workspace_.IsClosed(entry.state))
+            continue;
+        workspace_.Close(entry.state);
+        expansions_++;
+        if (entry.state == goal_) {
+            for (int cell = goal_; cell != from; cell = workspace_.get_parent(cell))
+                cells.push_back(cell);
+            cells.push_back(from);
+            std::reverse(cells.begin(), cells.end());
+            return true;
+        }
+        const std::pair<int, int> node = grid_.ToNode(entry.state);
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next))
+                continue;
+            // Cells which cannot reach the goal are walls for the BFS too
+            const int cell = grid_.ToIndex(next);
+            if (to_goal_[cell] < 0 || blocked_[cell] == epoch_)
+                continue;
+            if (entry.state == from && std::find(forbidden_.begin(), forbidden_.end(), cell) != forbidden_.end())
+                continue;
+            const double cost = workspace_.get_cost(entry.state) + 1 + penalty_[cell];
+            if (cost < workspace_.get_cost(cell)) {
+                workspace_.Update(cell, cost, entry.state);
+                workspace_.Push(cost + to_goal_[cell] - kDepthTieBreak * cost, cell);
+            }
+        }
+    }
+    return false;
+}
+
+void AlternativePaths::ToPath(const std::vector<int> &cells, Path &path) const {
+    std::vector<std::pair<int, int>> nodes;
+    nodes.reserve(cells.size());
+    for (const int &cell : cells)
+        nodes.push_back(grid_.ToNode(cell));
+    path.Assign(nodes);
+}
@@ -0,0 +1,152 @@
+/*
+ * @file        AnytimePlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file AnytimePlanner.cpp contains the definitions for AnytimePlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "../include/AnytimePlanner.h"
+#include "../include/BitGrid.h"
+#include "../include/SearchWorkspace.h"
+
+AnytimePlanner::AnytimePlanner(const BitGrid &grid, const double &initial_epsilon,
+                               const double &epsilon_step)
+        : grid_{grid}, initial_epsilon_{std::max(initial_epsilon, 1.0)},
+          epsilon_step_{std::max(epsilon_step, 0.01)} {}
+
+double AnytimePlanner::Heuristic(const int &state) const {
+    const std::pair<int, int> node = grid_.ToNode(state);
+    return std::abs(node.first - goal_.first) + std::abs(node.second - goal_.second);
+}
+
+int AnytimePlanner::Plan(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                         const std::chrono::microseconds &budget, AnytimeResult &result) {
+    return Plan(start, goal, Clock::now() + budget, result);
+}
+
+int AnytimePlanner::Plan(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                         const Clock::time_point &deadline, AnytimeResult &result) {
+    result.path.clear();
+    result.cost = -1;
+    result.bound = -1;
+    result.iterations = 0;
+    result.expansions = 0;
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return -1;
+    workspace_ = &SearchWorkspace::Local();
+    workspace_->Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    inconsistent_.clear();
+    expansions_ = 0;
+    goal_ = goal;
+    goal_state_ = grid_.ToIndex(goal);
+    epsilon_ = initial_epsilon_;
+    const int start_state = grid_.ToIndex(start);
+    workspace_->Update(start_state, 0, start_state);
+    workspace_->Push(epsilon_ * Heuristic(start_state), start_state);
+    while (ImprovePath(deadline)) {
+        const double goal_cost = workspace_->get_cost(goal_state_);
+        if (std::isinf(goal_cost))
+            break; // The open list ran dry, the goal is unreachable
+        // Publish the path of the completed iteration with the bound it proves
+        result.iterations++;
+        result.cost = goal_cost;
+        result.path.clear();
+        for (int state = goal_state_;; state = workspace_->get_parent(state)) {
+            result.path.push_back(grid_.ToNode(state));
+            if (state == start_state)
+                break;
+        }
+        std::reverse(result.path.begin(), result.path.end());
+        const double lower_bound = CollectFrontier();
+        result.bound = std::min(epsilon_, std::isinf(lower_bound) ? 1.0 : std::max(goal_cost / lower_bound, 1.0));
+        if (result.bound <= 1.0 || Clock::now() >= deadline)
+            break;
+        // Repair instead of restarting: keep the costs and reopen only the frontier
+        epsilon_ = std::max(1.0, epsilon_ - epsilon_step_);
+        workspace_->ReopenAll();
+        inconsistent_.clear();
+        for (const auto &state : rebuild_)
+            workspace_->Push(workspace_->get_cost(state) + epsilon_ * Heuristic(state), state);
+    }
+    result.expansions = expansions_;
+    return result.iterations > 0 ? 1 : -1;
+}
+
+bool AnytimePlanner::ImprovePath(const Clock::time_point &deadline) {
+    while (!workspace_->IsEmpty()) {
+        const HeapEntry top = workspace_->Top();
+        const double cost = workspace_->get_cost(top.state);
+        // Entries superseded by a cheaper push, or already expanded, are dropped
+        if (workspace_->IsClosed(top.state) || top.priority != cost + epsilon_ * Heuristic(top.state)) {
+            workspace_->Pop();
+            continue;
+        }
+        if (top.priority >= workspace_->get_cost(goal_state_))
+            return true;
+        if ((expansions_ & 255u) == 0 && Clock::now() >= deadline)
+            return false;
+        workspace_->Pop();
+        workspace_->Close(top.state);
+        expansions_++;
+        const std::pair<int, int> node = grid_.ToNode(top.state);
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int state = grid_.ToIndex(next);
+            if (cost + 1 >= workspace_->get_cost(state))
+                continue;
+            workspace_->Update(state, cost + 1, top.state);
+            if (workspace_->IsClosed(state))
+                inconsistent_.push_back(state);
+            else
+                workspace_->Push(cost + 1 + epsilon_ * Heuristic(state), state);
+        }
+    }
+    return true;
+}
+
+double AnytimePlanner::CollectFrontier() {
+    rebuild_.clear();
+    while (!workspace_->IsEmpty()) {
+        const HeapEntry entry = workspace_->Pop();
+        if (!workspace_->IsClosed(entry.state))
+            rebuild_.push_back(entry.state);
+    }
+    rebuild_.insert(rebuild_.end(), inconsistent_.begin(), inconsistent_.end());
+    std::sort(rebuild_.begin(), rebuild_.end());
+    rebuild_.erase(std::unique(rebuild_.begin(), rebuild_.end()), rebuild_.end());
+    double lower_bound = std::numeric_limits<double>::infinity();
+    for (const auto &state : rebuild_)
+        lower_bound = std::min(lower_bound, workspace_->get_cost(state) + Heuristic(state));
+    return lower_bound;
+}
@@ -0,0 +1,58 @@
+/*
+ * @file        BitGrid.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file BitGrid.cpp contains the definitions for BitGrid class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Maze.h"
+
+const int BitGrid::kMoveX[4] = {0, 0, 1, -1};
+const int BitGrid::kMoveY[4] = {-1, 1, 0, 0};
+
+BitGrid::BitGrid(const int &length, const int &width)
+        : length_{length}, width_{width}, words_per_row_{(length + 63) / 64},
+          bits_(static_cast<std::size_t>(width) * ((length + 63) / 64), 0) {}
+
+BitGrid::BitGrid(const Maze &maze) : BitGrid(maze.get_length(), maze.get_width()) {
+    for (int y = 0; y < width_; y++) {
+        for (int x = 0; x < length_; x++) {
+            if (maze.IsNotObstacle(std::make_pair(x, y)))
+                SetFree(x, y, true);
+        }
+    }
+}
+
+void BitGrid::SetFree(const int &x, const int &y, const bool &is_free) {
+    std::uint64_t &word = Row(y)[x >> 6];
+    const std::uint64_t mask = std::uint64_t{1} << (x & 63);
+    if (is_free)
+        word |= mask;
+    else
+        word &= ~mask;
+}
@@ -0,0 +1,57 @@
+/*
+ * @file        BucketQueue.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file BucketQueue.cpp contains the definitions for BucketQueue class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <cstddef>
+#include <vector>
+#include "../include/BucketQueue.h"
+
+void BucketQueue::Reset(const int &span) {
+    std::size_t count = 1;
+    while (count < static_cast<std::size_t>(span) + 1)
+        count <<= 1;
+    if (buckets_.size() < count)
+        buckets_.resize(count);
+    for (auto &bucket : buckets_)
+        bucket.clear();
+    mask_ = buckets_.size() - 1;
+    current_ = -1;
+    size_ = 0;
+}
+
+int BucketQueue::Pop(int &priority) {
+    std::vector<int> *bucket = &buckets_[static_cast<std::size_t>(current_) & mask_];
+    while (bucket->empty()) {
+        current_++;
+        bucket = &buckets_[static_cast<std::size_t>(current_) & mask_];
+    }
+    const int state = bucket->back();
+    bucket->pop_back();
+    size_--;
+    priority = current_;
+    return state;
+}
@@ -0,0 +1,120 @@
+/*
+ * @file        CommandRing.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file CommandRing.cpp contains the definitions for CommandRing and CommandExecutor
+ *              classes
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "../include/CommandRing.h"
+#include "../include/MobileRobot.h"
+#include "../include/Path.h"
+
+const std::size_t CommandRing::kDefaultCapacity;
+
+namespace {
+
+/*! \brief Failed attempts before a waiting side yields the processor */
+const int kSpins = 64;
+
+}  // namespace
+
+CommandRing::CommandRing(const std::size_t &capacity) {
+    std::size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    slots_.assign(size, 0);
+    mask_ = size - 1;
+}
+
+void CommandRing::Push(const std::uint8_t &command) {
+    if (TryPush(command))
+        return;
+    full_waits_.fetch_add(1, std::memory_order_relaxed);
+    for (int spins = 0; !TryPush(command); spins++) {
+        if (spins >= kSpins)
+            std::this_thread::yield();
+    }
+}
+
+bool CommandRing::Pop(std::uint8_t &command) {
+    for (int spins = 0;; spins++) {
+        if (TryPop(command))
+            return true;
+        // The producer closes after its last push, so a ring still empty after seeing
+        // the close is drained
+        if (is_closed_.load(std::memory_order_acquire))
+            return TryPop(command);
+        if (spins >= kSpins)
+            std::this_thread::yield();
+    }
+}
+
+void CommandRing::Reset() {
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+    cached_head_ = cached_tail_ = 0;
+    full_waits_.store(0, std::memory_order_relaxed);
+    is_closed_.store(false, std::memory_order_release);
+}
+
+CommandExecutor::~CommandExecutor() {
+    Join();
+}
+
+void CommandExecutor::Start(const std::shared_ptr<MobileRobot> &robot) {
+    Join();
+    executed_.store(0, std::memory_order_release);
+    thread_ = std::thread([this, robot]() {
+        std::uint8_t command;
+        while (ring_.Pop(command)) {
+            switch (command) {
+                case PathView::kUp:
+                    robot->Execute("UP");
+                    break;
+                case PathView::kDown:
+                    robot->Execute("DOWN");
+                    break;
+                case PathView::kLeft:
+                    robot->Execute("LEFT");
+                    break;
+                default:
+                    robot->Execute("RIGHT");
+                    break;
+            }
+            executed_.fetch_add(1, std::memory_order_release);
+        }
+    });
+}
+
+std::size_t CommandExecutor::Join() {
+    if (thread_.joinable())
+        thread_.join();
+    return executed_.load(std::memory_order_acquire);
+}
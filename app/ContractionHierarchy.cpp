@@ -0,0 +1,648 @@
+/*
+ * @file        ContractionHierarchy.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file ContractionHierarchy.cpp contains the definitions for ContractionHierarchy class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/ContractionHierarchy.h"
+#include "../include/ParallelFor.h"
+
+namespace {
+
+/*! \brief Nodes settled by a witness search before it gives up and a shortcut is added */
+const int kWitnessSettleLimit = 500;
+
+/*! \brief Nodes settled by the witness searches which estimate the priority of a node: only
+ * the source, so that only an arc between two neighbours counts as a witness. The estimate
+ * is redone for every neighbour of every contracted node, the contraction only once */
+const int kEstimateSettleLimit = 1;
+
+/*! \brief Landmarks whose distances to every node bound the rest of the path of a query */
+const int kLandmarkCount = 8;
+
+/*! \brief Nodes handed to a thread at a time */
+const int kChunk = 256;
+
+const int kInfinity = std::numeric_limits<int>::max();
+
+/*!
+ * \struct Shortcut
+ * \brief Define a shortcut found by contracting a node, between two of its neighbours
+ * */
+struct Shortcut {
+    int a, b, weight;
+};
+
+/*!
+ * \struct WitnessScratch
+ * \brief Define the state of the witness searches of one thread: tentative distance and
+ * stamp of every node, the length a witness to every target must not exceed (-1 for no
+ * target or a target already witnessed), the queue of (distance, node), and the shortcuts
+ * of a priority estimate
+ * */
+struct WitnessScratch {
+    std::vector<int> distance;
+    std::vector<std::uint32_t> stamp;
+    std::vector<int> limit;
+    std::uint32_t epoch = 0;
+    std::vector<std::pair<int, int>> queue;
+    std::vector<Shortcut> estimate;
+};
+
+/*! \brief Scrambles a node number, one to one, to break the ties between equal priorities */
+std::uint32_t Scramble(const int &node) {
+    std::uint32_t bits = static_cast<std::uint32_t>(node) * 0x9E3779B1u;
+    bits ^= bits >> 16;
+    bits *= 0x85EBCA6Bu;
+    return bits ^ (bits >> 13);
+}
+
+/*!
+ * \brief Finds the shortcuts needed to contract a node: for every pair of its neighbours,
+ * a shortcut unless a path at most as long avoids the node and the excluded nodes
+ * \param graph - remaining graph, arcs in both directions
+ * \param is_excluded - nodes being contracted in the same round
+ * \param node - node to contract
+ * \param settle_limit - nodes settled by a witness search before it gives up
+ * \param scratch - witness search state of the thread
+ * \param shortcuts - output, appended to
+ * \return number of shortcuts
+ * */
+int FindShortcuts(const std::vector<std::vector<HierarchyArc>> &graph, const std::vector<std::uint8_t> &is_excluded,
+                  const int &node, const int &settle_limit, WitnessScratch &scratch, std::vector<Shortcut> &shortcuts) {
+    const std::vector<HierarchyArc> &arcs = graph[node];
+    const auto later = std::greater<std::pair<int, int>>();
+    int count = 0;
+    for (std::size_t i = 0; i + 1 < arcs.size(); i++) {
+        const int source = arcs[i].target;
+        int bound = 0;
+        int pending = 0;
+        for (std::size_t j = i + 1; j < arcs.size(); j++) {
+            scratch.limit[arcs[j].target] = arcs[i].weight + arcs[j].weight;
+            bound = std::max(bound, arcs[i].weight + arcs[j].weight);
+            pending++;
+        }
+        // Dijkstra from the source around the node, until every target is witnessed
+        if (++scratch.epoch == 0) {
+            std::fill(scratch.stamp.begin(), scratch.stamp.end(), 0);
+            scratch.epoch = 1;
+        }
+        scratch.queue.clear();
+        scratch.queue.emplace_back(0, source);
+        scratch.distance[source] = 0;
+        scratch.stamp[source] = scratch.epoch;
+        int settled = 0;
+        while (!scratch.queue.empty() && pending > 0 && settled < settle_limit) {
+            std::pop_heap(scratch.queue.begin(), scratch.queue.end(), later);
+            const std::pair<int, int> top = scratch.queue.back();
+            scratch.queue.pop_back();
+            if (top.first > bound)
+                break;
+            if (top.first > scratch.distance[top.second])
+                continue;
+            settled++;
+            for (const auto &arc : graph[top.second]) {
+                const int next = arc.target;
+                if (next == node || is_excluded[next] != 0)
+                    continue;
+                const int distance = top.first + arc.weight;
+                if (scratch.stamp[next] != scratch.epoch || distance < scratch.distance[next]) {
+                    scratch.stamp[next] = scratch.epoch;
+                    scratch.distance[next] = distance;
+                    if (distance <= scratch.limit[next]) {
+                        scratch.limit[next] = -1;
+                        pending--;
+                    }
+                    scratch.queue.emplace_back(distance, next);
+                    std::push_heap(scratch.queue.begin(), scratch.queue.end(), later);
+                }
+            }
+        }
+        for (std::size_t j = i + 1; j < arcs.size(); j++) {
+            const int target = arcs[j].target;
+            const int through = arcs[i].weight + arcs[j].weight;
+            if (scratch.limit[target] < 0)
+                continue;
+            scratch.limit[target] = -1;
+            count++;
+            shortcuts.push_back(Shortcut{source, target, through});
+        }
+    }
+    return count;
+}
+
+/*! \brief Adds an arc to a node of the remaining graph, or shortens the arc it has to the same target */
+void AddArc(std::vector<HierarchyArc> &arcs, const HierarchyArc &arc) {
+    for (auto &existing : arcs) {
+        if (existing.target == arc.target) {
+            if (arc.weight < existing.weight)
+                existing = arc;
+            return;
+        }
+    }
+    arcs.push_back(arc);
+}
+
+}  // namespace
+
+std::size_t ContractionHierarchy::Build(const BitGrid &grid, const int &threads) {
+    const int workers = ThreadCount(threads);
+    length_ = grid.get_length();
+    width_ = grid.get_width();
+    // Free cells in row-major order are the nodes while building
+    std::vector<int> node_of(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    std::vector<int> cell_of;
+    for (int cell = 0; cell < grid.get_cell_count(); cell++) {
+        if (grid.IsNotObstacle(grid.ToNode(cell))) {
+            node_of[cell] = static_cast<int>(cell_of.size());
+            cell_of.push_back(cell);
+        }
+    }
+    const int count = static_cast<int>(cell_of.size());
+    std::vector<std::vector<HierarchyArc>> graph(cell_of.size());
+    for (int node = 0; node < count; node++) {
+        const int x = cell_of[node] % length_;
+        const int y = cell_of[node] / length_;
+        for (int d = 0; d < 4; d++) {
+            const int nx = x + BitGrid::kMoveX[d];
+            const int ny = y + BitGrid::kMoveY[d];
+            if (nx >= 0 && nx < length_ && ny >= 0 && ny < width_ && node_of[ny * length_ + nx] >= 0)
+                graph[node].push_back(HierarchyArc{node_of[ny * length_ + nx], 1, -1});
+        }
+    }
+
+    std::vector<WitnessScratch> scratch(static_cast<std::size_t>(workers));
+    for (auto &state : scratch) {
+        state.distance.assign(cell_of.size(), 0);
+        state.stamp.assign(cell_of.size(), 0);
+        state.limit.assign(cell_of.size(), -1);
+    }
+    std::vector<std::uint8_t> is_excluded(cell_of.size(), 0);
+    std::vector<int> priority(cell_of.size(), 0), deleted(cell_of.size(), 0), level(cell_of.size(), 0);
+    const auto update_priorities = [&](const std::vector<int> &nodes) {
+        ParallelFor(static_cast<int>(nodes.size()), workers, kChunk, [&](int begin, int end, int worker) {
+            WitnessScratch &state = scratch[worker];
+            for (int i = begin; i < end; i++) {
+                const int node = nodes[i];
+                state.estimate.clear();
+                const int added = FindShortcuts(graph, is_excluded, node, kEstimateSettleLimit, state, state.estimate);
+                int added_moves = 0, removed_moves = 0;
+                for (const auto &shortcut : state.estimate)
+                    added_moves += shortcut.weight;
+                for (const auto &arc : graph[node])
+                    removed_moves += arc.weight;
+                // Shortcuts added per arc removed and moves they stand for per move removed,
+                // with the removed neighbours and the level spreading the contraction evenly
+                // and keeping the hierarchy flat
+                const int degree = static_cast<int>(graph[node].size());
+                priority[node] = (degree == 0 ? 0 : 100 * added / degree + 300 * added_moves / removed_moves) +
+                                 10 * (deleted[node] + level[node]);
+            }
+        });
+    };
+
+    std::vector<int> remaining(cell_of.size());
+    for (int node = 0; node < count; node++)
+        remaining[node] = node;
+    update_priorities(remaining);
+
+    // Contraction rounds over an independent set of locally least important nodes. Ties are
+    // broken by scrambled numbers: on regular layouts whole areas tie, and breaking them by
+    // number would let a single node of each area through per round
+    std::vector<int> rank(cell_of.size(), -1);
+    std::vector<std::vector<HierarchyArc>> upward(cell_of.size());
+    std::vector<std::uint8_t> is_selected;
+    std::vector<int> batch, touched;
+    std::vector<std::vector<Shortcut>> shortcuts;
+    std::vector<std::uint32_t> touch_stamp(cell_of.size(), 0);
+    std::uint32_t round = 0;
+    int next_rank = 0;
+    std::size_t shortcut_count = 0;
+    while (!remaining.empty()) {
+        round++;
+        is_selected.assign(remaining.size(), 0);
+        ParallelFor(static_cast<int>(remaining.size()), workers, kChunk, [&](int begin, int end, int) {
+            for (int i = begin; i < end; i++) {
+                const int node = remaining[i];
+                bool is_least = true;
+                for (const auto &arc : graph[node]) {
+                    const int other = arc.target;
+                    if (std::make_pair(priority[other], Scramble(other)) < std::make_pair(priority[node], Scramble(node))) {
+                        is_least = false;
+                        break;
+                    }
+                }
+                is_selected[i] = is_least ? 1 : 0;
+            }
+        });
+        batch.clear();
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < remaining.size(); i++) {
+            if (is_selected[i] != 0)
+                batch.push_back(remaining[i]);
+            else
+                remaining[kept++] = remaining[i];
+        }
+        remaining.resize(kept);
+        for (const int node : batch)
+            is_excluded[node] = 1;
+        shortcuts.resize(batch.size());
+        ParallelFor(static_cast<int>(batch.size()), workers, kChunk, [&](int begin, int end, int worker) {
+            for (int i = begin; i < end; i++) {
+                shortcuts[i].clear();
+                FindShortcuts(graph, is_excluded, batch[i], kWitnessSettleLimit, scratch[worker], shortcuts[i]);
+            }
+        });
+        // Nodes of the batch are never neighbours, so their contractions do not interfere
+        touched.clear();
+        for (std::size_t i = 0; i < batch.size(); i++) {
+            const int node = batch[i];
+            rank[node] = next_rank++;
+            for (const auto &arc : graph[node]) {
+                const int other = arc.target;
+                auto &arcs = graph[other];
+                for (std::size_t j = 0; j < arcs.size(); j++) {
+                    if (arcs[j].target == node) {
+                        arcs[j] = arcs.back();
+                        arcs.pop_back();
+                        break;
+                    }
+                }
+                deleted[other]++;
+                level[other] = std::max(level[other], level[node] + 1);
+                if (touch_stamp[other] != round) {
+                    touch_stamp[other] = round;
+                    touched.push_back(other);
+                }
+            }
+            for (const auto &shortcut : shortcuts[i]) {
+                AddArc(graph[shortcut.a], HierarchyArc{shortcut.b, shortcut.weight, node});
+                AddArc(graph[shortcut.b], HierarchyArc{shortcut.a, shortcut.weight, node});
+            }
+            shortcut_count += shortcuts[i].size();
+            upward[node].swap(graph[node]);
+            is_excluded[node] = 0;
+        }
+        update_priorities(touched);
+    }
+
+    // Renumber the nodes in contraction order and pack the upward arcs
+    cells_.resize(cell_of.size());
+    coordinates_.resize(cell_of.size());
+    nodes_.assign(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    for (int node = 0; node < count; node++) {
+        cells_[rank[node]] = static_cast<std::uint32_t>(cell_of[node]);
+        coordinates_[rank[node]] = grid.ToNode(cell_of[node]);
+        nodes_[cell_of[node]] = rank[node];
+    }
+    first_arc_.assign(cell_of.size() + std::size_t{1}, 0);
+    for (int node = 0; node < count; node++)
+        first_arc_[rank[node] + 1] = static_cast<std::uint32_t>(upward[node].size());
+    for (int node = 0; node < count; node++)
+        first_arc_[node + 1] += first_arc_[node];
+    arcs_.resize(first_arc_.back());
+    for (int node = 0; node < count; node++) {
+        HierarchyArc *arcs = arcs_.data() + first_arc_[rank[node]];
+        for (std::size_t i = 0; i < upward[node].size(); i++) {
+            const HierarchyArc &arc = upward[node][i];
+            arcs[i] = HierarchyArc{rank[arc.target], arc.weight, arc.middle < 0 ? -1 : rank[arc.middle]};
+        }
+        std::sort(arcs, arcs + upward[node].size(), [](const HierarchyArc &a, const HierarchyArc &b) {
+            return a.target < b.target;
+        });
+    }
+    PlaceLandmarks();
+    meeting_ = -1;
+    return shortcut_count;
+}
+
+bool ContractionHierarchy::Save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cout << "Save contraction hierarchy failed, cannot open " << path << std::endl;
+        return false;
+    }
+    ContractionHeader header;
+    header.length = static_cast<std::uint32_t>(length_);
+    header.width = static_cast<std::uint32_t>(width_);
+    header.node_count = static_cast<std::uint32_t>(cells_.size());
+    header.arc_count = static_cast<std::uint32_t>(arcs_.size());
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto *words : {&cells_, &first_arc_})
+        file.write(reinterpret_cast<const char *>(words->data()),
+                   static_cast<std::streamsize>(words->size() * sizeof(std::uint32_t)));
+    file.write(reinterpret_cast<const char *>(arcs_.data()),
+               static_cast<std::streamsize>(arcs_.size() * sizeof(HierarchyArc)));
+    if (!file) {
+        std::cout << "Save contraction hierarchy failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool ContractionHierarchy::Load(const std::string &path, const BitGrid &grid) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Load contraction hierarchy failed, cannot open " << path << std::endl;
+        return false;
+    }
+    ContractionHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || std::string(header.magic, 4) != "MZCH" || header.version != 1) {
+        std::cout << "Load contraction hierarchy failed, " << path << " is not a contraction hierarchy" << std::endl;
+        return false;
+    }
+    if (static_cast<int>(header.length) != grid.get_length() ||
+        static_cast<int>(header.width) != grid.get_width()) {
+        std::cout << "Load contraction hierarchy failed, " << path << " was built for another map" << std::endl;
+        return false;
+    }
+    // Every free cell of the map must be a node, or the map has changed. The counts of
+    // the header are checked before they size anything, against the map and the file
+    std::size_t free_cells = 0;
+    for (int cell = 0; cell < grid.get_cell_count(); cell++)
+        free_cells += grid.IsNotObstacle(grid.ToNode(cell)) ? 1 : 0;
+    file.seekg(0, std::ios::end);
+    const auto file_bytes = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(sizeof(header));
+    const std::uint64_t expected_bytes = sizeof(header) +
+            sizeof(std::uint32_t) * (2 * static_cast<std::uint64_t>(header.node_count) + 1) +
+            sizeof(HierarchyArc) * static_cast<std::uint64_t>(header.arc_count);
+    if (header.node_count != free_cells || file_bytes != expected_bytes) {
+        std::cout << "Load contraction hierarchy failed, " << path << " does not match the map" << std::endl;
+        return false;
+    }
+    cells_.resize(header.node_count);
+    first_arc_.resize(header.node_count + std::size_t{1});
+    arcs_.resize(header.arc_count);
+    for (auto *words : {&cells_, &first_arc_})
+        file.read(reinterpret_cast<char *>(words->data()),
+                  static_cast<std::streamsize>(words->size() * sizeof(std::uint32_t)));
+    file.read(reinterpret_cast<char *>(arcs_.data()),
+              static_cast<std::streamsize>(arcs_.size() * sizeof(HierarchyArc)));
+    length_ = grid.get_length();
+    width_ = grid.get_width();
+    nodes_.assign(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    coordinates_.resize(cells_.size());
+    bool is_valid = static_cast<bool>(file) && first_arc_.front() == 0 && first_arc_.back() == header.arc_count &&
+                    std::is_sorted(first_arc_.begin(), first_arc_.end());
+    for (std::size_t node = 0; is_valid && node < cells_.size(); node++) {
+        const int cell = static_cast<int>(cells_[node]);
+        is_valid = cell < grid.get_cell_count() && grid.IsNotObstacle(grid.ToNode(cell)) && nodes_[cell] < 0;
+        if (is_valid) {
+            nodes_[cell] = static_cast<int>(node);
+            coordinates_[node] = grid.ToNode(cell);
+        }
+        // Arcs go up, and shortcuts bypass a lower node
+        for (std::uint32_t i = first_arc_[node]; is_valid && i < first_arc_[node + 1]; i++)
+            is_valid = arcs_[i].target > static_cast<int>(node) && arcs_[i].target < static_cast<int>(cells_.size()) &&
+                       arcs_[i].middle >= -1 && arcs_[i].middle < static_cast<int>(node);
+    }
+    if (!is_valid) {
+        std::cout << "Load contraction hierarchy failed, " << path << " does not match the map" << std::endl;
+        cells_.clear();
+        coordinates_.clear();
+        nodes_.clear();
+        first_arc_.clear();
+        arcs_.clear();
+        landmark_distances_.clear();
+        return false;
+    }
+    PlaceLandmarks();
+    meeting_ = -1;
+    return true;
+}
+
+int ContractionHierarchy::Distance(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    const int from = NodeOf(start);
+    const int to = NodeOf(goal);
+    if (from < 0 || to < 0)
+        return -1;
+    return Search(from, to);
+}
+
+int ContractionHierarchy::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path) {
+    const int distance = Distance(start, goal);
+    if (distance < 0) {
+        path.Clear();
+        return -1;
+    }
+    // Up from the start to the meeting node, then down to the goal
+    nodes_on_path_.clear();
+    nodes_on_path_.push_back(coordinates_[NodeOf(start)]);
+    unpack_stack_.clear();
+    for (int node = meeting_; labels_[0][node].parent >= 0; node = labels_[0][node].parent)
+        unpack_stack_.emplace_back(labels_[0][node].parent, node);
+    for (std::size_t i = unpack_stack_.size(); i-- > 0;) {
+        const std::pair<int, int> arc_ends = unpack_stack_[i];
+        AppendArc(arc_ends.first, arc_ends.second);
+    }
+    for (int node = meeting_; labels_[1][node].parent >= 0; node = labels_[1][node].parent)
+        AppendArc(node, labels_[1][node].parent);
+    path.Assign(nodes_on_path_);
+    return distance;
+}
+
+std::size_t ContractionHierarchy::get_bytes() const {
+    return cells_.size() * sizeof(std::uint32_t) + coordinates_.size() * sizeof(std::pair<int, int>) +
+           nodes_.size() * sizeof(int) + landmark_distances_.size() * sizeof(int) +
+           first_arc_.size() * sizeof(std::uint32_t) + arcs_.size() * sizeof(HierarchyArc);
+}
+
+int ContractionHierarchy::Search(const int &from, const int &to) {
+    const std::size_t count = cells_.size();
+    // Smallest key first and, between equal keys, the more important node
+    const auto later = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+    if (labels_[0].size() != count || ++epoch_ == 0) {
+        for (auto &labels : labels_)
+            labels.assign(count, SearchLabel());
+        epoch_ = 1;
+    }
+    // A node is keyed by its distance plus a lower bound of the rest of the path: the
+    // Manhattan distance to the other end, or the difference of their distances to a
+    // landmark when a wall lies between them
+    const int ends[2] = {from, to};
+    const std::pair<int, int> targets[2] = {coordinates_[to], coordinates_[from]};
+    const int *target_landmarks[2] = {&landmark_distances_[static_cast<std::size_t>(to) * kLandmarkCount],
+                                      &landmark_distances_[static_cast<std::size_t>(from) * kLandmarkCount]};
+    const auto remaining = [&](const int &side, const int &node) {
+        int bound = std::abs(coordinates_[node].first - targets[side].first) +
+                    std::abs(coordinates_[node].second - targets[side].second);
+        const int *landmarks = &landmark_distances_[static_cast<std::size_t>(node) * kLandmarkCount];
+        for (int i = 0; i < kLandmarkCount; i++)
+            bound = std::max(bound, std::abs(landmarks[i] - target_landmarks[side][i]));
+        return bound;
+    };
+    for (int side = 0; side < 2; side++) {
+        queue_[side].clear();
+        queue_[side].emplace_back(remaining(side, ends[side]), ends[side]);
+        labels_[side][ends[side]] = SearchLabel{epoch_, 0, -1};
+    }
+    int best = kInfinity;
+    meeting_ = -1;
+    settled_ = 0;
+    // Both searches go up until neither queue can improve the best meeting. On open maps
+    // most keys equal the length of the path, so the searches take turns on equal keys
+    // and stop as soon as they meet
+    int side = 1;
+    while (true) {
+        const int other_side = 1 - side;
+        const bool is_open[2] = {!queue_[0].empty() && queue_[0].front().first < best,
+                                 !queue_[1].empty() && queue_[1].front().first < best};
+        if (is_open[other_side] &&
+            (!is_open[side] || queue_[other_side].front().first <= queue_[side].front().first))
+            side = other_side;
+        else if (!is_open[side])
+            break;
+        std::vector<SearchLabel> &labels = labels_[side];
+        const std::vector<SearchLabel> &others = labels_[1 - side];
+        std::pop_heap(queue_[side].begin(), queue_[side].end(), later);
+        const int node = queue_[side].back().second;
+        const int distance = queue_[side].back().first - remaining(side, node);
+        queue_[side].pop_back();
+        if (distance > labels[node].distance)
+            continue;
+        settled_++;
+        if (others[node].stamp == epoch_ && distance + others[node].distance < best) {
+            best = distance + others[node].distance;
+            meeting_ = node;
+        }
+        // Stall on demand: a node reached more cheaply down from a node above is not on a
+        // shortest up path, so its arcs are not relaxed
+        bool is_stalled = false;
+        for (std::uint32_t i = first_arc_[node]; i < first_arc_[node + 1] && !is_stalled; i++)
+            is_stalled = labels[arcs_[i].target].stamp == epoch_ &&
+                         labels[arcs_[i].target].distance + arcs_[i].weight < distance;
+        if (is_stalled)
+            continue;
+        for (std::uint32_t i = first_arc_[node]; i < first_arc_[node + 1]; i++) {
+            const HierarchyArc &arc = arcs_[i];
+            SearchLabel &label = labels[arc.target];
+            if (label.stamp == epoch_ && distance + arc.weight >= label.distance)
+                continue;
+            label = SearchLabel{epoch_, distance + arc.weight, node};
+            if (others[arc.target].stamp == epoch_ && label.distance + others[arc.target].distance < best) {
+                best = label.distance + others[arc.target].distance;
+                meeting_ = arc.target;
+            }
+            const int key = label.distance + remaining(side, arc.target);
+            if (key < best) {
+                queue_[side].emplace_back(key, arc.target);
+                std::push_heap(queue_[side].begin(), queue_[side].end(), later);
+            }
+        }
+    }
+    return meeting_ < 0 ? -1 : best;
+}
+
+void ContractionHierarchy::PlaceLandmarks() {
+    const std::size_t count = cells_.size();
+    landmark_distances_.assign(count * kLandmarkCount, 0);
+    if (count == 0)
+        return;
+    // Breadth first search over the moves from a node; nodes it does not reach keep 0,
+    // which is a valid bound since no path joins them to the nodes it reaches
+    std::vector<int> distance(count), nearest(count, kInfinity);
+    std::vector<int> queue;
+    queue.reserve(count);
+    const auto search = [&](const int &source) {
+        std::fill(distance.begin(), distance.end(), -1);
+        queue.clear();
+        queue.push_back(source);
+        distance[source] = 0;
+        for (std::size_t head = 0; head < queue.size(); head++) {
+            const int node = queue[head];
+            const int x = static_cast<int>(cells_[node]) % length_;
+            const int y = static_cast<int>(cells_[node]) / length_;
+            for (int move = 0; move < 4; move++) {
+                const int next = NodeOf(std::make_pair(x + BitGrid::kMoveX[move], y + BitGrid::kMoveY[move]));
+                if (next >= 0 && distance[next] < 0) {
+                    distance[next] = distance[node] + 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+    };
+    // Every landmark is the node farthest from the previous ones, starting from the node
+    // farthest from the last contracted one, so that they spread over the edges of the map
+    search(static_cast<int>(count) - 1);
+    int landmark = queue.back();
+    for (int i = 0; i < kLandmarkCount; i++) {
+        search(landmark);
+        for (std::size_t node = 0; node < count; node++) {
+            landmark_distances_[node * kLandmarkCount + i] = std::max(distance[node], 0);
+            if (distance[node] >= 0)
+                nearest[node] = std::min(nearest[node], distance[node]);
+        }
+        landmark = static_cast<int>(std::max_element(nearest.begin(), nearest.end(), [](const int &a, const int &b) {
+            return (a == kInfinity ? -1 : a) < (b == kInfinity ? -1 : b);
+        }) - nearest.begin());
+    }
+}
+
+void ContractionHierarchy::AppendArc(const int &from, const int &to) {
+    // Shortcuts are split through the node they bypass until only moves are left
+    const std::size_t bottom = unpack_stack_.size();
+    unpack_stack_.emplace_back(from, to);
+    while (unpack_stack_.size() > bottom) {
+        const std::pair<int, int> arc_ends = unpack_stack_.back();
+        unpack_stack_.pop_back();
+        const HierarchyArc &arc = FindArc(arc_ends.first, arc_ends.second);
+        if (arc.middle < 0) {
+            nodes_on_path_.push_back(coordinates_[arc_ends.second]);
+        } else {
+            unpack_stack_.emplace_back(arc.middle, arc_ends.second);
+            unpack_stack_.emplace_back(arc_ends.first, arc.middle);
+        }
+    }
+}
+
+const HierarchyArc &ContractionHierarchy::FindArc(const int &a, const int &b) const {
+    const int low = std::min(a, b);
+    const int high = std::max(a, b);
+    const auto first = arcs_.begin() + first_arc_[low];
+    const auto last = arcs_.begin() + first_arc_[low + 1];
+    return *std::lower_bound(first, last, high, [](const HierarchyArc &arc, const int &target) {
+        return arc.target < target;
+    });
+}
+
+int ContractionHierarchy::NodeOf(const std::pair<int, int> &node) const {
+    if (node.first < 0 || node.first >= length_ || node.second < 0 || node.second >= width_ || nodes_.empty())
+        return -1;
+    return nodes_[node.second * length_ + node.first];
+}
@@ -0,0 +1,442 @@
+/*
+ * @file        CorridorGraph.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file CorridorGraph.cpp contains the definitions for CorridorGraph class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/CorridorGraph.h"
+#include "../include/Path.h"
+#include "../include/SearchWorkspace.h"
+
+/*! \brief Block displacement and opposite of every direction, indexed by kMove value:
+ * the bits of links_ and the directions of the corridors are these codes */
+static const int kStepX[4] = {0, 0, -1, 1};
+static const int kStepY[4] = {1, -1, 0, 0};
+static const int kOpposite[4] = {1, 0, 3, 2};
+
+/*! \brief Bit of links_ set for a free block */
+static const std::uint8_t kFreeBlock = 0x10;
+
+/*! \brief Number of openings of a block */
+static int Degree(const std::uint8_t &links) {
+    return (links & 1) + ((links >> 1) & 1) + ((links >> 2) & 1) + ((links >> 3) & 1);
+}
+
+/*!
+ * \brief Records the state of a part of the lattice, checking that all its cells agree
+ * \param state - state of the part, -1 while none of its cells has been seen
+ * \param is_free - state of the current cell
+ * \return false if the part has both free and blocked cells
+ * */
+static bool Agree(std::int8_t &state, const bool &is_free) {
+    if (state < 0)
+        state = is_free ? 1 : 0;
+    return state == (is_free ? 1 : 0);
+}
+
+const int CorridorGraph::kMoveUp;
+const int CorridorGraph::kMoveDown;
+const int CorridorGraph::kMoveLeft;
+const int CorridorGraph::kMoveRight;
+
+CorridorGraph::CorridorGraph(const BitGrid &grid) : grid_{grid} {}
+
+int CorridorGraph::Neighbour(const int &block, const int &direction) const {
+    return block + kStepY[direction] * blocks_x_ + kStepX[direction];
+}
+
+int CorridorGraph::Continue(const int &block, const int &direction) const {
+    const int links = (links_[block] & 0xF) & ~(1 << kOpposite[direction]);
+    return links & 1 ? 0 : links & 2 ? 1 : links & 4 ? 2 : 3;
+}
+
+void CorridorGraph::Walk(const int &block, const int &direction, const int &steps,
+                         std::vector<int> &blocks) const {
+    blocks.clear();
+    int current = block, heading = direction;
+    for (int step = 0; step < steps; step++) {
+        if (step > 0)
+            heading = Continue(current, heading);
+        current = Neighbour(current, heading);
+        blocks.push_back(current);
+    }
+}
+
+int CorridorGraph::BlockOf(const std::pair<int, int> &node, int &next) const {
+    next = -1;
+    const int rx = node.first - lattice_.offset_x, ry = node.second - lattice_.offset_y;
+    if (rx < 0 || ry < 0)
+        return -1;
+    const int ix = rx / lattice_.pitch_x, iy = ry / lattice_.pitch_y;
+    const bool is_gap_x = rx % lattice_.pitch_x >= lattice_.width_x;
+    const bool is_gap_y = ry % lattice_.pitch_y >= lattice_.width_y;
+    if (ix >= blocks_x_ || iy >= blocks_y_ || (is_gap_x && is_gap_y) ||
+        (is_gap_x && ix + 1 >= blocks_x_) || (is_gap_y && iy + 1 >= blocks_y_))
+        return -1;
+    const int block = iy * blocks_x_ + ix;
+    if (is_gap_x)
+        next = block + 1;
+    else if (is_gap_y)
+        next = block + blocks_x_;
+    return block;
+}
+
+bool CorridorGraph::Build(const CorridorLattice &lattice) {
+    if (lattice.width_x < 1 || lattice.width_x > lattice.pitch_x || lattice.offset_x < 0 ||
+        lattice.width_y < 1 || lattice.width_y > lattice.pitch_y || lattice.offset_y < 0) {
+        std::cout << "Build corridor graph failed, invalid lattice" << std::endl;
+        return false;
+    }
+    lattice_ = lattice;
+    const int length = grid_.get_length(), rows = grid_.get_width();
+    const int span_x = length - lattice.offset_x - lattice.width_x;
+    const int span_y = rows - lattice.offset_y - lattice.width_y;
+    blocks_x_ = span_x >= 0 ? span_x / lattice.pitch_x + 1 : 0;
+    blocks_y_ = span_y >= 0 ? span_y / lattice.pitch_y + 1 : 0;
+    const std::size_t blocks = static_cast<std::size_t>(blocks_x_) * blocks_y_;
+    links_.assign(blocks, 0);
+    block_vertex_.assign(blocks, -1);
+    block_edge_.assign(blocks, -1);
+    block_step_.assign(blocks, 0);
+    block_cost_.assign(blocks, 0);
+    vertex_block_.clear();
+    edges_.clear();
+    free_blocks_ = 0;
+    // Every cell is in a block, in the opening right of a block, in the opening above a
+    // block, or outside the lattice where it is ignored
+    std::vector<std::int8_t> block_state(blocks, -1), right_state(blocks, -1), up_state(blocks, -1);
+    for (int y = 0; y < rows; y++) {
+        for (int x = 0; x < length; x++) {
+            int next = -1;
+            const int block = BlockOf(std::make_pair(x, y), next);
+            if (block < 0)
+                continue;
+            const bool is_free = grid_.IsNotObstacle(std::make_pair(x, y));
+            bool is_fit;
+            if (next < 0)
+                is_fit = Agree(block_state[block], is_free);
+            else if (next == block + 1)
+                is_fit = Agree(right_state[block], is_free);
+            else
+                is_fit = Agree(up_state[block], is_free);
+            if (!is_fit) {
+                std::cout << "Build corridor graph failed, cell (" << x << ", " << y
+                          << ") does not fit the lattice" << std::endl;
+                return false;
+            }
+        }
+    }
+    // Openings link two free blocks; without wall between blocks, free neighbours link
+    for (int iy = 0; iy < blocks_y_; iy++) {
+        for (int ix = 0; ix < blocks_x_; ix++) {
+            const int block = iy * blocks_x_ + ix;
+            if (block_state[block] != 1)
+                continue;
+            links_[block] |= kFreeBlock;
+            free_blocks_++;
+            const int right = ix + 1 < blocks_x_ ? block + 1 : -1;
+            const int up = iy + 1 < blocks_y_ ? block + blocks_x_ : -1;
+            const std::int8_t openings[2] = {right_state[block], up_state[block]};
+            const int neighbours[2] = {right, up};
+            const int directions[2] = {kMoveRight, kMoveUp};
+            for (int i = 0; i < 2; i++) {
+                if (openings[i] == 0 || neighbours[i] < 0)
+                    continue;
+                if (block_state[neighbours[i]] != 1) {
+                    if (openings[i] == 1) {
+                        std::cout << "Build corridor graph failed, an opening of block (" << ix << ", " << iy
+                                  << ") leads to a wall" << std::endl;
+                        return false;
+                    }
+                    continue;
+                }
+                links_[block] |= static_cast<std::uint8_t>(1 << directions[i]);
+                links_[neighbours[i]] |= static_cast<std::uint8_t>(1 << kOpposite[directions[i]]);
+            }
+        }
+    }
+    // Junctions and dead ends are vertices, then one block of every closed loop
+    for (std::size_t block = 0; block < blocks; block++) {
+        if ((links_[block] & kFreeBlock) && Degree(links_[block]) != 2) {
+            block_vertex_[block] = static_cast<int>(vertex_block_.size());
+            vertex_block_.push_back(static_cast<int>(block));
+        }
+    }
+    const int vertex_count = static_cast<int>(vertex_block_.size());
+    for (int vertex = 0; vertex < vertex_count; vertex++)
+        AddEdges(vertex);
+    for (std::size_t block = 0; block < blocks; block++) {
+        if ((links_[block] & kFreeBlock) && block_vertex_[block] < 0 && block_edge_[block] < 0) {
+            block_vertex_[block] = static_cast<int>(vertex_block_.size());
+            vertex_block_.push_back(static_cast<int>(block));
+            AddEdges(block_vertex_[block]);
+        }
+    }
+    // Incidence lists, grouped by vertex
+    first_incidence_.assign(vertex_block_.size() + 1, 0);
+    for (const auto &edge : edges_) {
+        first_incidence_[edge.a + 1]++;
+        first_incidence_[edge.b + 1]++;
+    }
+    for (std::size_t vertex = 0; vertex < vertex_block_.size(); vertex++)
+        first_incidence_[vertex + 1] += first_incidence_[vertex];
+    incidences_.resize(edges_.size() * 2);
+    std::vector<int> fill(first_incidence_.begin(), first_incidence_.end() - 1);
+    for (std::size_t e = 0; e < edges_.size(); e++) {
+        incidences_[fill[edges_[e].a]++] = std::make_pair(edges_[e].b, static_cast<int>(e) * 2);
+        incidences_[fill[edges_[e].b]++] = std::make_pair(edges_[e].a, static_cast<int>(e) * 2 + 1);
+    }
+    return true;
+}
+
+void CorridorGraph::AddEdges(const int &vertex) {
+    const int block = vertex_block_[vertex];
+    for (int direction = 0; direction < 4; direction++) {
+        if (!(links_[block] & (1 << direction)))
+            continue;
+        int current = Neighbour(block, direction), heading = direction, steps = 1, cost = StepCost(direction);
+        while (block_vertex_[current] < 0) {
+            heading = Continue(current, heading);
+            current = Neighbour(current, heading);
+            steps++;
+            cost += StepCost(heading);
+        }
+        // Each corridor is met from both of its ends, it is kept from the smaller one
+        const int other = block_vertex_[current];
+        const int back = kOpposite[heading];
+        if (std::make_pair(vertex, direction) > std::make_pair(other, back))
+            continue;
+        CorridorEdge edge;
+        edge.a = vertex;
+        edge.b = other;
+        edge.direction_a = static_cast<std::uint8_t>(direction);
+        edge.direction_b = static_cast<std::uint8_t>(back);
+        edge.length = steps;
+        edge.cost = cost;
+        const int id = static_cast<int>(edges_.size());
+        edges_.push_back(edge);
+        current = block;
+        heading = direction;
+        cost = 0;
+        for (int step = 1; step < steps; step++) {
+            if (step > 1)
+                heading = Continue(current, heading);
+            current = Neighbour(current, heading);
+            cost += StepCost(heading);
+            block_edge_[current] = id;
+            block_step_[current] = step;
+            block_cost_[current] = cost;
+        }
+    }
+}
+
+void CorridorGraph::AllowCells(const int &x0, const int &y0, const int &x1, const int &y1) {
+    for (int y = y0; y <= y1; y++)
+        for (int x = x0; x <= x1; x++)
+            allowed_[static_cast<std::size_t>(y) * grid_.get_length() + x] = epoch_;
+}
+
+void CorridorGraph::Allow(const int &block) {
+    const int x0 = lattice_.offset_x + lattice_.pitch_x * (block % blocks_x_);
+    const int y0 = lattice_.offset_y + lattice_.pitch_y * (block / blocks_x_);
+    AllowCells(x0, y0, x0 + lattice_.width_x - 1, y0 + lattice_.width_y - 1);
+}
+
+void CorridorGraph::AllowOpening(const int &block, const int &next) {
+    const int first = std::min(block, next);
+    const int x0 = lattice_.offset_x + lattice_.pitch_x * (first % blocks_x_);
+    const int y0 = lattice_.offset_y + lattice_.pitch_y * (first / blocks_x_);
+    if (std::abs(next - block) == 1)
+        AllowCells(x0 + lattice_.width_x, y0, x0 + lattice_.pitch_x - 1, y0 + lattice_.width_y - 1);
+    else
+        AllowCells(x0, y0 + lattice_.width_y, x0 + lattice_.width_x - 1, y0 + lattice_.pitch_y - 1);
+}
+
+void CorridorGraph::AppendSegment(const int &edge, const int &from, const int &to) {
+    const CorridorEdge &corridor = edges_[edge];
+    if (from < to) {
+        // Positions from + 1 to "to", walking from the end a
+        Walk(vertex_block_[corridor.a], corridor.direction_a, to, walk_);
+        route_.insert(route_.end(), walk_.begin() + from, walk_.begin() + to);
+    } else if (from > to) {
+        // Positions from - 1 down to "to", walking from the end b
+        Walk(vertex_block_[corridor.b], corridor.direction_b, corridor.length - to, walk_);
+        route_.insert(route_.end(), walk_.begin() + (corridor.length - from), walk_.end());
+    }
+}
+
+int CorridorGraph::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path) {
+    path.Clear();
+    expansions_ = 0;
+    expanded_cells_ = 0;
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return -1;
+    int start_next = -1, goal_next = -1;
+    const int start_block = BlockOf(start, start_next);
+    const int goal_block = BlockOf(goal, goal_next);
+    if (start_block < 0 || goal_block < 0 || !(links_[start_block] & kFreeBlock) ||
+        !(links_[goal_block] & kFreeBlock))
+        return -1;
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    route_.clear();
+    route_.push_back(start_block);
+    if (start_block != goal_block) {
+        // States are the vertices, plus the start and goal blocks when they are corridor
+        const int vertex_count = static_cast<int>(vertex_block_.size());
+        const int start_state = vertex_count, goal_state = vertex_count + 1;
+        const int goal_vertex = block_vertex_[goal_block];
+        const int target = goal_vertex >= 0 ? goal_vertex : goal_state;
+        const int goal_x = goal_block % blocks_x_, goal_y = goal_block / blocks_x_;
+        workspace.Reset(static_cast<std::size_t>(vertex_count) + 2);
+        via_edge_.resize(static_cast<std::size_t>(vertex_count) + 2);
+        via_from_.resize(via_edge_.size());
+        via_to_.resize(via_edge_.size());
+        auto relax = [&](const int &state, const int &cost, const int &parent, const int &edge,
+                         const int &from, const int &to) {
+            if (workspace.IsClosed(state) || cost >= workspace.get_cost(state))
+                return;
+            workspace.Update(state, cost, parent);
+            via_edge_[state] = edge;
+            via_from_[state] = from;
+            via_to_[state] = to;
+            int heuristic = 0;
+            if (state < vertex_count) {
+                const int block = vertex_block_[state];
+                heuristic = lattice_.pitch_x * std::abs(block % blocks_x_ - goal_x) +
+                            lattice_.pitch_y * std::abs(block / blocks_x_ - goal_y);
+            }
+            workspace.Push(cost + heuristic, state);
+        };
+        workspace.Update(start_state, 0, start_state);
+        workspace.Close(start_state);
+        const int goal_edge = block_edge_[goal_block];
+        const int goal_step = block_step_[goal_block];
+        const int goal_cost = block_cost_[goal_block];
+        if (block_vertex_[start_block] >= 0) {
+            relax(block_vertex_[start_block], 0, start_state, -1, 0, 0);
+        } else {
+            const int start_edge = block_edge_[start_block];
+            const int start_step = block_step_[start_block];
+            const int start_cost = block_cost_[start_block];
+            const CorridorEdge &corridor = edges_[start_edge];
+            relax(corridor.a, start_cost, start_state, start_edge, start_step, 0);
+            relax(corridor.b, corridor.cost - start_cost, start_state, start_edge, start_step, corridor.length);
+            if (goal_vertex < 0 && goal_edge == start_edge)
+                relax(goal_state, std::abs(goal_cost - start_cost), start_state, start_edge, start_step, goal_step);
+        }
+        bool is_found = false;
+        while (!workspace.IsEmpty()) {
+            const int state = workspace.Pop().state;
+            if (workspace.IsClosed(state))
+                continue;
+            workspace.Close(state);
+            expansions_++;
+            if (state == target) {
+                is_found = true;
+                break;
+            }
+            const int cost = static_cast<int>(workspace.get_cost(state));
+            for (int i = first_incidence_[state]; i < first_incidence_[state + 1]; i++) {
+                const int edge = incidences_[i].second >> 1;
+                const int length = edges_[edge].length;
+                const bool is_from_b = (incidences_[i].second & 1) != 0;
+                relax(incidences_[i].first, cost + edges_[edge].cost, state, edge,
+                      is_from_b ? length : 0, is_from_b ? 0 : length);
+            }
+            if (goal_vertex < 0) {
+                const CorridorEdge &corridor = edges_[goal_edge];
+                if (state == corridor.a)
+                    relax(goal_state, cost + goal_cost, state, goal_edge, 0, goal_step);
+                if (state == corridor.b)
+                    relax(goal_state, cost + corridor.cost - goal_cost, state, goal_edge, corridor.length, goal_step);
+            }
+        }
+        if (!is_found)
+            return -1;
+        // States from the target back to the start, then the blocks of each step
+        queue_.clear();
+        for (int state = target; state != start_state; state = workspace.get_parent(state))
+            queue_.push_back(state);
+        for (auto state = queue_.rbegin(); state != queue_.rend(); ++state) {
+            if (via_edge_[*state] >= 0)
+                AppendSegment(via_edge_[*state], via_from_[*state], via_to_[*state]);
+        }
+    }
+    // Breadth first search over the cells of the route
+    const std::size_t cells = static_cast<std::size_t>(grid_.get_cell_count());
+    if (allowed_.size() != cells) {
+        allowed_.assign(cells, 0);
+        epoch_ = 0;
+    }
+    if (++epoch_ == 0) {
+        std::fill(allowed_.begin(), allowed_.end(), 0);
+        epoch_ = 1;
+    }
+    Allow(route_[0]);
+    for (std::size_t i = 1; i < route_.size(); i++) {
+        Allow(route_[i]);
+        AllowOpening(route_[i - 1], route_[i]);
+    }
+    if (start_next >= 0)
+        AllowOpening(start_block, start_next);
+    if (goal_next >= 0)
+        AllowOpening(goal_block, goal_next);
+    const int start_cell = grid_.ToIndex(start), goal_cell = grid_.ToIndex(goal);
+    workspace.Reset(cells);
+    workspace.Update(start_cell, 0, start_cell);
+    queue_.clear();
+    queue_.push_back(start_cell);
+    for (std::size_t head = 0; head < queue_.size(); head++) {
+        const int cell = queue_[head];
+        expanded_cells_++;
+        if (cell == goal_cell)
+            break;
+        const std::pair<int, int> node = grid_.ToNode(cell);
+        for (int direction = 0; direction < 4; direction++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[direction],
+                                           node.second + BitGrid::kMoveY[direction]};
+            if (!grid_.IsWithinRegion(next))
+                continue;
+            const int next_cell = grid_.ToIndex(next);
+            if (allowed_[next_cell] != epoch_ || workspace.IsSeen(next_cell) || !grid_.IsNotObstacle(next))
+                continue;
+            workspace.Update(next_cell, workspace.get_cost(cell) + 1, cell);
+            queue_.push_back(next_cell);
+        }
+    }
+    if (!workspace.IsSeen(goal_cell))
+        return -1;
+    path.Reconstruct(workspace, goal_cell, grid_.get_length());
+    return static_cast<int>(path.get_move_count());
+}
@@ -0,0 +1,61 @@
+/*
+ * @file        CostMap.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file CostMap.cpp contains the definitions for CostMap class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "../include/CostMap.h"
+
+const std::uint8_t CostMap::kFloor;
+const std::uint8_t CostMap::kRamp;
+const std::uint8_t CostMap::kSlow;
+const std::uint8_t CostMap::kNoStop;
+const std::uint8_t CostMap::kRough;
+
+CostMap::CostMap(const int &length, const int &width)
+        : length_{length}, width_{width},
+          terrain_(static_cast<std::size_t>(length) * width, kFloor) {}
+
+void CostMap::SetTerrain(const int &x, const int &y, const std::uint8_t &terrain) {
+    terrain_[static_cast<std::size_t>(y) * length_ + x] = terrain;
+}
+
+void CostMap::Fill(const std::pair<int, int> &first, const std::pair<int, int> &last,
+                   const std::uint8_t &terrain) {
+    const int x0 = std::max(0, std::min(first.first, last.first));
+    const int x1 = std::min(length_ - 1, std::max(first.first, last.first));
+    const int y0 = std::max(0, std::min(first.second, last.second));
+    const int y1 = std::min(width_ - 1, std::max(first.second, last.second));
+    for (int y = y0; y <= y1; y++) {
+        if (x0 > x1)
+            break;
+        std::uint8_t *row = terrain_.data() + static_cast<std::size_t>(y) * length_;
+        std::fill(row + x0, row + x1 + 1, terrain);
+    }
+}
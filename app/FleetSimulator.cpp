@@ -0,0 +1,172 @@
+/*
+ * @file        FleetSimulator.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file FleetSimulator.cpp contains the definitions for FleetSimulator class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/FleetSimulator.h"
+#include "../include/MobileRobot.h"
+#include "../include/PlannerServer.h"
+
+/*! \brief Displacement of every command, indexed by kCommand value, the encoding of the
+ * server replies, so this is not the BitGrid order */
+static const int kCommandX[4] = {0, 0, -1, 1};
+static const int kCommandY[4] = {1, -1, 0, 0};
+
+/*! \brief Opposite command and first 90 degree turn, indexed by kCommand value */
+static const std::uint32_t kOpposite[4] = {kCommandDown, kCommandUp, kCommandRight, kCommandLeft};
+static const std::uint32_t kSideways[4] = {kCommandLeft, kCommandLeft, kCommandUp, kCommandUp};
+
+FleetSimulator::FleetSimulator(const BitGrid &grid, const int &ticks_per_unit)
+        : grid_{grid}, ticks_per_unit_{std::max(ticks_per_unit, 1)},
+          occupancy_((static_cast<std::size_t>(grid.get_cell_count()) + 63) / 64, 0) {}
+
+void FleetSimulator::PathToCommands(const std::vector<std::pair<int, int>> &path,
+                                    std::vector<std::uint8_t> &commands) {
+    commands.clear();
+    for (std::size_t i = 1; i < path.size(); i++) {
+        const int dx = path[i].first - path[i - 1].first;
+        const int dy = path[i].second - path[i - 1].second;
+        if (dx == 1)
+            commands.push_back(kCommandRight);
+        else if (dx == -1)
+            commands.push_back(kCommandLeft);
+        else if (dy == 1)
+            commands.push_back(kCommandUp);
+        else if (dy == -1)
+            commands.push_back(kCommandDown);
+    }
+}
+
+void FleetSimulator::SetOccupied(const int &x, const int &y, const bool &is_occupied) {
+    const std::size_t bit = static_cast<std::size_t>(y) * grid_.get_length() + x;
+    if (is_occupied)
+        occupancy_[bit >> 6] |= std::uint64_t{1} << (bit & 63);
+    else
+        occupancy_[bit >> 6] &= ~(std::uint64_t{1} << (bit & 63));
+}
+
+int FleetSimulator::AddRobot(const MobileRobot &robot, const std::pair<int, int> &start,
+                             const std::vector<std::uint8_t> &commands) {
+    if (!grid_.IsWithinRegion(start) || !grid_.IsNotObstacle(start) || IsOccupied(start.first, start.second))
+        return -1;
+    SetOccupied(start.first, start.second, true);
+    x_.push_back(start.first);
+    y_.push_back(start.second);
+    heading_.push_back(kCommandUp);
+    timer_.push_back(0);
+    cursor_.push_back(static_cast<std::uint32_t>(commands_.size()));
+    for (const auto &command : commands)
+        commands_.push_back(static_cast<std::uint8_t>(command & 3u));
+    end_.push_back(static_cast<std::uint32_t>(commands_.size()));
+    // The only virtual calls, made once per robot
+    const auto ticks = [this](const double &cost) {
+        return static_cast<std::uint32_t>(std::max(1.0, std::round(cost * ticks_per_unit_)));
+    };
+    move_ticks_.push_back(ticks(robot.get_move_cost()));
+    turn_ticks_.push_back(ticks(robot.get_turn_cost()));
+    is_stopped_.push_back(0);
+    if (!commands.empty())
+        active_count_++;
+    return static_cast<int>(x_.size()) - 1;
+}
+
+void FleetSimulator::Clear() {
+    for (auto *column : {&heading_, &timer_, &cursor_, &end_, &move_ticks_, &turn_ticks_, &is_stopped_})
+        column->clear();
+    x_.clear();
+    y_.clear();
+    commands_.clear();
+    std::fill(occupancy_.begin(), occupancy_.end(), 0);
+    step_count_ = move_count_ = turn_count_ = wait_count_ = active_count_ = 0;
+}
+
+void FleetSimulator::Step() {
+    const std::size_t robots = x_.size();
+    std::uint32_t *timer = timer_.data();
+    const std::uint32_t *cursor = cursor_.data();
+    const std::uint32_t *end = end_.data();
+    const std::uint32_t *is_stopped = is_stopped_.data();
+    // Pass 1, branch free so that it vectorizes: count down the running actions
+    for (std::size_t i = 0; i < robots; i++)
+        timer[i] -= timer[i] != 0 ? 1u : 0u;
+    // Pass 2: collect the robots whose action is over and which have commands left
+    ready_.resize(robots);
+    std::size_t ready = 0;
+    std::size_t active = 0;
+    for (std::size_t i = 0; i < robots; i++) {
+        const std::uint32_t has_work = (cursor[i] < end[i]) & (is_stopped[i] == 0);
+        ready_[ready] = static_cast<std::uint32_t>(i);
+        ready += (timer[i] == 0) & has_work;
+        active += (timer[i] != 0) | has_work;
+    }
+    active_count_ = active;
+    // Pass 3: start the next action of every ready robot
+    for (std::size_t k = 0; k < ready; k++) {
+        const std::uint32_t i = ready_[k];
+        const std::uint32_t command = commands_[cursor_[i]];
+        if (heading_[i] != command) {
+            // Turn in place, a reversal takes two turns
+            heading_[i] = kOpposite[heading_[i]] == command ? kSideways[command] : command;
+            timer_[i] = turn_ticks_[i];
+            turn_count_++;
+            continue;
+        }
+        const int x = x_[i] + kCommandX[command];
+        const int y = y_[i] + kCommandY[command];
+        if (!grid_.IsWithinRegion(std::make_pair(x, y)) || !grid_.IsNotObstacle(std::make_pair(x, y))) {
+            is_stopped_[i] = 1;
+            continue;
+        }
+        if (IsOccupied(x, y)) {
+            wait_count_++;
+            continue;
+        }
+        SetOccupied(x_[i], y_[i], false);
+        SetOccupied(x, y, true);
+        x_[i] = x;
+        y_[i] = y;
+        cursor_[i]++;
+        timer_[i] = move_ticks_[i];
+        move_count_++;
+    }
+    step_count_++;
+}
+
+std::size_t FleetSimulator::Run(const std::size_t &max_steps) {
+    std::size_t steps = 0;
+    while (steps < max_steps && active_count_ > 0) {
+        Step();
+        steps++;
+    }
+    return steps;
+}
@@ -0,0 +1,344 @@
+/*
+ * @file        HierarchicalPlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file HierarchicalPlanner.cpp contains the definitions for
+ *              HierarchicalPlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/HierarchicalPlanner.h"
+#include "../include/SearchWorkspace.h"
+
+HierarchicalPlanner::HierarchicalPlanner(BitGrid &grid, const int &cluster_size)
+        : grid_{grid}, cluster_size_{cluster_size},
+          clusters_x_{(grid.get_length() + cluster_size - 1) / cluster_size},
+          clusters_y_{(grid.get_width() + cluster_size - 1) / cluster_size},
+          local_distance_(static_cast<std::size_t>(cluster_size) * cluster_size, -1),
+          local_parent_(local_distance_.size(), -1), local_queue_(local_distance_.size(), 0) {
+    const std::size_t clusters = static_cast<std::size_t>(clusters_x_) * clusters_y_;
+    east_links_.resize(clusters);
+    south_links_.resize(clusters);
+    cluster_nodes_.resize(clusters);
+    cluster_distance_.resize(clusters);
+    for (int c = 0; c < get_cluster_count(); c++) {
+        FindEntrances(c, true);
+        FindEntrances(c, false);
+    }
+    for (int c = 0; c < get_cluster_count(); c++)
+        BuildCluster(c);
+    Assemble();
+}
+
+int HierarchicalPlanner::get_node_count() const {
+    return static_cast<int>(nodes_.size());
+}
+
+int HierarchicalPlanner::get_cluster_count() const {
+    return clusters_x_ * clusters_y_;
+}
+
+int HierarchicalPlanner::ClusterOf(const int &x, const int &y) const {
+    return (y / cluster_size_) * clusters_x_ + x / cluster_size_;
+}
+
+void HierarchicalPlanner::FindEntrances(const int &cluster, const bool &is_east) {
+    std::vector<std::pair<int, int>> &links = is_east ? east_links_[cluster] : south_links_[cluster];
+    links.clear();
+    const int cx = cluster % clusters_x_, cy = cluster / clusters_x_;
+    if ((is_east && cx + 1 >= clusters_x_) || (!is_east && cy + 1 >= clusters_y_))
+        return;
+    const int x0 = cx * cluster_size_, y0 = cy * cluster_size_;
+    const int x1 = std::min(x0 + cluster_size_, grid_.get_length()) - 1;
+    const int y1 = std::min(y0 + cluster_size_, grid_.get_width()) - 1;
+    const int count = is_east ? y1 - y0 + 1 : x1 - x0 + 1;
+    // Cell pair at position i of the border: inside the cluster and across the border
+    auto side = [&](const int &i) {
+        return is_east ? std::make_pair(std::make_pair(x1, y0 + i), std::make_pair(x1 + 1, y0 + i))
+                       : std::make_pair(std::make_pair(x0 + i, y1), std::make_pair(x0 + i, y1 + 1));
+    };
+    auto link = [&](const int &i) {
+        const auto cells = side(i);
+        links.emplace_back(grid_.ToIndex(cells.first), grid_.ToIndex(cells.second));
+    };
+    int run_begin = -1;
+    for (int i = 0; i <= count; i++) {
+        const bool is_open = i < count && grid_.IsNotObstacle(side(i).first) &&
+                             grid_.IsNotObstacle(side(i).second);
+        if (is_open && run_begin < 0) {
+            run_begin = i;
+        } else if (!is_open && run_begin >= 0) {
+            // Short runs get one entrance in the middle, long runs one at each end
+            const int run_end = i - 1;
+            if (run_end - run_begin + 1 < 6) {
+                link((run_begin + run_end) / 2);
+            } else {
+                link(run_begin);
+                link(run_end);
+            }
+            run_begin = -1;
+        }
+    }
+}
+
+void HierarchicalPlanner::BuildCluster(const int &cluster) {
+    std::vector<int> &nodes = cluster_nodes_[cluster];
+    nodes.clear();
+    for (const auto &link : east_links_[cluster])
+        nodes.push_back(link.first);
+    for (const auto &link : south_links_[cluster])
+        nodes.push_back(link.first);
+    if (cluster % clusters_x_ > 0) {
+        for (const auto &link : east_links_[cluster - 1])
+            nodes.push_back(link.second);
+    }
+    if (cluster >= clusters_x_) {
+        for (const auto &link : south_links_[cluster - clusters_x_])
+            nodes.push_back(link.second);
+    }
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    const std::size_t count = nodes.size();
+    std::vector<int> &distance = cluster_distance_[cluster];
+    distance.assign(count * count, -1);
+    for (std::size_t i = 0; i < count; i++) {
+        SearchCluster(cluster, nodes[i], -1);
+        for (std::size_t j = 0; j < count; j++)
+            distance[i * count + j] = LocalDistance(nodes[j]);
+    }
+}
+
+void HierarchicalPlanner::Assemble() {
+    nodes_.clear();
+    node_index_.clear();
+    for (const auto &cluster : cluster_nodes_) {
+        for (const auto &cell : cluster) {
+            node_index_[cell] = static_cast<int>(nodes_.size());
+            nodes_.push_back(cell);
+        }
+    }
+    edges_.assign(nodes_.size(), std::vector<AbstractEdge>());
+    for (std::size_t c = 0; c < cluster_nodes_.size(); c++) {
+        const std::vector<int> &nodes = cluster_nodes_[c];
+        const std::size_t count = nodes.size();
+        for (std::size_t i = 0; i < count; i++) {
+            const int from = node_index_[nodes[i]];
+            for (std::size_t j = 0; j < count; j++) {
+                const int cost = cluster_distance_[c][i * count + j];
+                if (i != j && cost > 0)
+                    edges_[from].push_back(AbstractEdge{node_index_[nodes[j]], cost});
+            }
+        }
+        for (const auto *links : {&east_links_[c], &south_links_[c]}) {
+            for (const auto &link : *links) {
+                const int a = node_index_[link.first], b = node_index_[link.second];
+                edges_[a].push_back(AbstractEdge{b, 1});
+                edges_[b].push_back(AbstractEdge{a, 1});
+            }
+        }
+    }
+}
+
+int HierarchicalPlanner::SearchCluster(const int &cluster, const int &source, const int &target) {
+    local_x0_ = (cluster % clusters_x_) * cluster_size_;
+    local_y0_ = (cluster / clusters_x_) * cluster_size_;
+    const int x1 = std::min(local_x0_ + cluster_size_, grid_.get_length());
+    const int y1 = std::min(local_y0_ + cluster_size_, grid_.get_width());
+    std::fill(local_distance_.begin(), local_distance_.end(), -1);
+    const std::pair<int, int> origin = grid_.ToNode(source);
+    const int first = (origin.second - local_y0_) * cluster_size_ + origin.first - local_x0_;
+    local_distance_[first] = 0;
+    local_parent_[first] = -1;
+    local_queue_[0] = first;
+    int head = 0, tail = 1;
+    while (head < tail) {
+        const int local = local_queue_[head++];
+        const int x = local_x0_ + local % cluster_size_, y = local_y0_ + local / cluster_size_;
+        if (grid_.ToIndex(std::make_pair(x, y)) == target)
+            break;
+        for (int d = 0; d < 4; d++) {
+            const int nx = x + BitGrid::kMoveX[d], ny = y + BitGrid::kMoveY[d];
+            if (nx < local_x0_ || nx >= x1 || ny < local_y0_ || ny >= y1 ||
+                !grid_.IsNotObstacle(std::make_pair(nx, ny)))
+                continue;
+            const int next = (ny - local_y0_) * cluster_size_ + nx - local_x0_;
+            if (local_distance_[next] >= 0)
+                continue;
+            local_distance_[next] = local_distance_[local] + 1;
+            local_parent_[next] = local;
+            local_queue_[tail++] = next;
+        }
+    }
+    return tail;
+}
+
+int HierarchicalPlanner::LocalDistance(const int &cell) const {
+    const std::pair<int, int> node = grid_.ToNode(cell);
+    return local_distance_[(node.second - local_y0_) * cluster_size_ + node.first - local_x0_];
+}
+
+void HierarchicalPlanner::AppendLocalPath(const int &cell, std::vector<std::pair<int, int>> &path) const {
+    const std::pair<int, int> node = grid_.ToNode(cell);
+    const std::size_t begin = path.size();
+    int local = (node.second - local_y0_) * cluster_size_ + node.first - local_x0_;
+    while (local_parent_[local] >= 0) {
+        path.emplace_back(local_x0_ + local % cluster_size_, local_y0_ + local / cluster_size_);
+        local = local_parent_[local];
+    }
+    std::reverse(path.begin() + static_cast<std::ptrdiff_t>(begin), path.end());
+}
+
+void HierarchicalPlanner::SetFree(const int &x, const int &y, const bool &is_free) {
+    grid_.SetFree(x, y, is_free);
+    dirty_.insert(ClusterOf(x, y));
+}
+
+int HierarchicalPlanner::Rebuild() {
+    if (dirty_.empty())
+        return 0;
+    std::set<int> touched;
+    for (const auto &cluster : dirty_) {
+        const int cx = cluster % clusters_x_, cy = cluster / clusters_x_;
+        // The four borders of an edited cluster may have changed, and with them the
+        // nodes of the clusters on the other side
+        FindEntrances(cluster, true);
+        FindEntrances(cluster, false);
+        touched.insert(cluster);
+        if (cx > 0) {
+            FindEntrances(cluster - 1, true);
+            touched.insert(cluster - 1);
+        }
+        if (cy > 0) {
+            FindEntrances(cluster - clusters_x_, false);
+            touched.insert(cluster - clusters_x_);
+        }
+        if (cx + 1 < clusters_x_)
+            touched.insert(cluster + 1);
+        if (cy + 1 < clusters_y_)
+            touched.insert(cluster + clusters_x_);
+    }
+    for (const auto &cluster : touched)
+        BuildCluster(cluster);
+    Assemble();
+    dirty_.clear();
+    return static_cast<int>(touched.size());
+}
+
+int HierarchicalPlanner::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                                  std::vector<std::pair<int, int>> &path) {
+    path.clear();
+    Rebuild();
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return -1;
+    if (start == goal) {
+        path.push_back(start);
+        return 0;
+    }
+    // The start and goal join the abstract graph as two extra nodes
+    const int node_count = static_cast<int>(nodes_.size());
+    const int start_id = node_count, goal_id = node_count + 1;
+    const int start_cell = grid_.ToIndex(start), goal_cell = grid_.ToIndex(goal);
+    const int start_cluster = ClusterOf(start.first, start.second);
+    const int goal_cluster = ClusterOf(goal.first, goal.second);
+    std::vector<AbstractEdge> start_edges, goal_edges;
+    SearchCluster(start_cluster, start_cell, -1);
+    for (const auto &cell : cluster_nodes_[start_cluster]) {
+        if (LocalDistance(cell) >= 0)
+            start_edges.push_back(AbstractEdge{node_index_[cell], LocalDistance(cell)});
+    }
+    if (start_cluster == goal_cluster && LocalDistance(goal_cell) >= 0)
+        start_edges.push_back(AbstractEdge{goal_id, LocalDistance(goal_cell)});
+    SearchCluster(goal_cluster, goal_cell, -1);
+    for (const auto &cell : cluster_nodes_[goal_cluster]) {
+        if (LocalDistance(cell) >= 0)
+            goal_edges.push_back(AbstractEdge{node_index_[cell], LocalDistance(cell)});
+    }
+    auto cell_of = [&](const int &id) {
+        return id == start_id ? start_cell : (id == goal_id ? goal_cell : nodes_[id]);
+    };
+    auto heuristic = [&](const int &id) {
+        const std::pair<int, int> node = grid_.ToNode(cell_of(id));
+        return std::abs(node.first - goal.first) + std::abs(node.second - goal.second);
+    };
+    // A* over the abstract graph
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    workspace.Reset(static_cast<std::size_t>(node_count) + 2);
+    workspace.Update(start_id, 0, -1);
+    workspace.Push(heuristic(start_id), start_id);
+    auto relax = [&](const int &from, const AbstractEdge &edge) {
+        const double cost = workspace.get_cost(from) + edge.cost;
+        if (!workspace.IsClosed(edge.to) && cost < workspace.get_cost(edge.to)) {
+            workspace.Update(edge.to, cost, from);
+            workspace.Push(cost + heuristic(edge.to), edge.to);
+        }
+    };
+    while (!workspace.IsEmpty()) {
+        const int id = workspace.Pop().state;
+        if (workspace.IsClosed(id))
+            continue;
+        workspace.Close(id);
+        if (id == goal_id)
+            break;
+        if (id == start_id) {
+            for (const auto &edge : start_edges)
+                relax(id, edge);
+            continue;
+        }
+        for (const auto &edge : edges_[id])
+            relax(id, edge);
+        if (ClusterOf(grid_.ToNode(nodes_[id]).first, grid_.ToNode(nodes_[id]).second) == goal_cluster) {
+            for (const auto &edge : goal_edges) {
+                if (edge.to == id)
+                    relax(id, AbstractEdge{goal_id, edge.cost});
+            }
+        }
+    }
+    if (!workspace.IsClosed(goal_id))
+        return -1;
+    // Refine the abstract path: entrance edges are single moves, the other edges are
+    // searched again inside their cluster
+    std::vector<int> abstract_path;
+    for (int id = goal_id; id >= 0; id = workspace.get_parent(id))
+        abstract_path.push_back(id);
+    std::reverse(abstract_path.begin(), abstract_path.end());
+    path.push_back(start);
+    for (std::size_t i = 1; i < abstract_path.size(); i++) {
+        const int from = cell_of(abstract_path[i - 1]), to = cell_of(abstract_path[i]);
+        const std::pair<int, int> from_node = grid_.ToNode(from), to_node = grid_.ToNode(to);
+        const int from_cluster = ClusterOf(from_node.first, from_node.second);
+        if (from_cluster != ClusterOf(to_node.first, to_node.second)) {
+            path.push_back(to_node);
+        } else {
+            SearchCluster(from_cluster, from, to);
+            AppendLocalPath(to, path);
+        }
+    }
+    return static_cast<int>(path.size()) - 1;
+}
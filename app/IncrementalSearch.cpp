@@ -0,0 +1,108 @@
+/*
+ * @file        IncrementalSearch.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file IncrementalSearch.cpp contains the definitions for IncrementalSearch class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include "../include/BitGrid.h"
+#include "../include/IncrementalSearch.h"
+#include "../include/Path.h"
+
+const int IncrementalSearch::kIdle;
+const int IncrementalSearch::kNoPath;
+const int IncrementalSearch::kSearching;
+const int IncrementalSearch::kFound;
+const int IncrementalSearch::kSliceExpansions;
+
+IncrementalSearch::IncrementalSearch(const BitGrid &grid) : grid_{grid} {}
+
+int IncrementalSearch::Start(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    start_ = start;
+    goal_ = goal;
+    expansions_ = 0;
+    workspace_.Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal)) {
+        status_ = kNoPath;
+        return status_;
+    }
+    const int cell = grid_.ToIndex(start);
+    workspace_.Update(cell, 0, cell);
+    workspace_.Push(Heuristic(start), cell);
+    status_ = kSearching;
+    return status_;
+}
+
+int IncrementalSearch::Step(const int &max_expansions) {
+    const int goal_cell = status_ == kSearching ? grid_.ToIndex(goal_) : -1;
+    for (int expanded = 0; status_ == kSearching && expanded < max_expansions;) {
+        if (workspace_.IsEmpty()) {
+            status_ = kNoPath;
+            break;
+        }
+        const HeapEntry entry = workspace_.Pop();
+        // Skip entries which were superseded by a cheaper push of the same node
+        if (workspace_.IsClosed(entry.state))
+            continue;
+        workspace_.Close(entry.state);
+        expanded++;
+        expansions_++;
+        if (entry.state == goal_cell) {
+            status_ = kFound;
+            break;
+        }
+        const std::pair<int, int> node = grid_.ToNode(entry.state);
+        const double cost = workspace_.get_cost(entry.state) + 1;
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int next_cell = grid_.ToIndex(next);
+            if (cost < workspace_.get_cost(next_cell)) {
+                workspace_.Update(next_cell, cost, entry.state);
+                workspace_.Push(cost + Heuristic(next), next_cell);
+            }
+        }
+    }
+    return status_;
+}
+
+int IncrementalSearch::RunUntil(const std::chrono::steady_clock::time_point &deadline) {
+    while (Step(kSliceExpansions) == kSearching && std::chrono::steady_clock::now() < deadline) {
+    }
+    return status_;
+}
+
+bool IncrementalSearch::GetPath(Path &path) const {
+    if (status_ != kFound) {
+        path.Clear();
+        return false;
+    }
+    path.Reconstruct(workspace_, grid_.ToIndex(goal_), grid_.get_length());
+    return true;
+}
@@ -0,0 +1,135 @@
+/*
+ * @file        LatticePlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file LatticePlanner.cpp contains the definitions for LatticePlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/LatticePlanner.h"
+#include "../include/MobileRobot.h"
+#include "../include/SearchWorkspace.h"
+
+/*! \brief Displacement of a forward move, indexed by heading: the headings are part of
+ * the lattice states, so this is not the BitGrid order */
+static const int kForwardX[4] = {0, 0, -1, 1};
+static const int kForwardY[4] = {1, -1, 0, 0};
+
+/*! \brief Headings reached by a 90 degree turn, indexed by heading */
+static const int kTurns[4][2] = {{2, 3}, {2, 3}, {0, 1}, {0, 1}};
+
+/*! \brief Opposite heading, indexed by heading */
+static const int kOpposite[4] = {1, 0, 3, 2};
+
+const int LatticePlanner::kHeadingUp;
+const int LatticePlanner::kHeadingDown;
+const int LatticePlanner::kHeadingLeft;
+const int LatticePlanner::kHeadingRight;
+
+LatticePlanner::LatticePlanner(const BitGrid &grid) : grid_{grid} {}
+
+double LatticePlanner::Heuristic(const int &state) const {
+    const std::pair<int, int> node = grid_.ToNode(state >> 2);
+    const int heading = state & 3;
+    const int dx = goal_.first - node.first;
+    const int dy = goal_.second - node.second;
+    double cost = move_cost_ * (std::abs(dx) + std::abs(dy));
+    // Every heading the robot still needs costs at least one turn, a reversal two
+    if (dx != 0 && dy != 0) {
+        const int horizontal = dx > 0 ? kHeadingRight : kHeadingLeft;
+        const int vertical = dy > 0 ? kHeadingUp : kHeadingDown;
+        cost += turn_cost_ * (heading == horizontal || heading == vertical ? 1 : 2);
+    } else if (dx != 0 || dy != 0) {
+        const int needed = dx > 0 ? kHeadingRight : dx < 0 ? kHeadingLeft : dy > 0 ? kHeadingUp : kHeadingDown;
+        cost += turn_cost_ * (heading == needed ? 0 : heading == kOpposite[needed] ? 2 : 1);
+    }
+    return cost;
+}
+
+double LatticePlanner::FindPath(const std::pair<int, int> &start, const int &heading,
+                                const std::pair<int, int> &goal, const MobileRobot &robot,
+                                std::vector<std::pair<int, int>> &path) {
+    path.clear();
+    turn_count_ = 0;
+    expansions_ = 0;
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) || heading < 0 || heading > 3 ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return -1;
+    goal_ = goal;
+    move_cost_ = robot.get_move_cost();
+    turn_cost_ = robot.get_turn_cost();
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    workspace.Reset(static_cast<std::size_t>(grid_.get_cell_count()) * 4);
+    const int start_state = grid_.ToIndex(start) * 4 + heading;
+    const int goal_cell = grid_.ToIndex(goal);
+    workspace.Update(start_state, 0, start_state);
+    workspace.Push(Heuristic(start_state), start_state);
+    int reached = -1;
+    while (!workspace.IsEmpty()) {
+        const HeapEntry entry = workspace.Pop();
+        if (workspace.IsClosed(entry.state))
+            continue;
+        workspace.Close(entry.state);
+        expansions_++;
+        if (entry.state >> 2 == goal_cell) {
+            reached = entry.state;
+            break;
+        }
+        const double cost = workspace.get_cost(entry.state);
+        const int current = entry.state & 3;
+        const std::pair<int, int> node = grid_.ToNode(entry.state >> 2);
+        // Successors: one move forward, or a turn to either side
+        int successors[3] = {-1, (entry.state & ~3) | kTurns[current][0], (entry.state & ~3) | kTurns[current][1]};
+        double step[3] = {move_cost_, turn_cost_, turn_cost_};
+        const std::pair<int, int> next{node.first + kForwardX[current], node.second + kForwardY[current]};
+        if (grid_.IsWithinRegion(next) && grid_.IsNotObstacle(next))
+            successors[0] = grid_.ToIndex(next) * 4 + current;
+        for (int i = 0; i < 3; i++) {
+            const int state = successors[i];
+            if (state < 0 || workspace.IsClosed(state) || cost + step[i] >= workspace.get_cost(state))
+                continue;
+            workspace.Update(state, cost + step[i], entry.state);
+            workspace.Push(cost + step[i] + Heuristic(state), state);
+        }
+    }
+    if (reached < 0)
+        return -1;
+    // Walk back, turns stay in the same cell and are counted rather than stored
+    for (int state = reached;; state = workspace.get_parent(state)) {
+        const int parent = workspace.get_parent(state);
+        if (state != parent && state >> 2 == parent >> 2)
+            turn_count_++;
+        else
+            path.push_back(grid_.ToNode(state >> 2));
+        if (state == start_state)
+            break;
+    }
+    std::reverse(path.begin(), path.end());
+    return workspace.get_cost(reached);
+}
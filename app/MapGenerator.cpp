@@ -0,0 +1,276 @@
+/*
+ * @file        MapGenerator.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file MapGenerator.cpp contains the definitions for MapGenerator class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/MapGenerator.h"
+#include "../include/ParallelFor.h"
+
+/*! \brief Maze cell rows per stripe */
+static const int kStripeRows = 128;
+
+/*! \brief Side of a room sector, a multiple of 64 so that sectors never share a word */
+static const int kSectorSize = 512;
+
+/*! \brief Grid rows per warehouse stripe */
+static const int kWarehouseRows = 256;
+
+/*!
+ * \class Random
+ * \brief The Random class is a small xorshift64* generator seeded through splitmix64,
+ * so that every (seed, stream) pair gives an independent sequence
+ */
+class Random {
+public:
+    Random(const std::uint64_t &seed, const std::uint64_t &stream) {
+        std::uint64_t z = seed + 0x9E3779B97F4A7C15ull * (stream + 1);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        state_ = (z ^ (z >> 31)) | 1u;
+    }
+
+    /*! \brief Next 64 random bits */
+    std::uint64_t Next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1Dull;
+    }
+
+    /*! \brief Random integer in [0, bound) */
+    std::uint32_t Below(const std::uint32_t &bound) {
+        return static_cast<std::uint32_t>(((Next() >> 32) * bound) >> 32);
+    }
+
+    /*! \brief Random number in [0, 1) */
+    double Uniform() { return static_cast<double>(Next() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+    std::uint64_t state_;
+};
+
+/*!
+ * \brief Carves an L shaped corridor, along x first and then along y
+ * \param grid - map to carve
+ * \param from - first end
+ * \param to - second end
+ * */
+static void CarveCorridor(BitGrid &grid, const std::pair<int, int> &from, const std::pair<int, int> &to) {
+    for (int x = std::min(from.first, to.first); x <= std::max(from.first, to.first); x++)
+        grid.SetFree(x, from.second, true);
+    for (int y = std::min(from.second, to.second); y <= std::max(from.second, to.second); y++)
+        grid.SetFree(to.first, y, true);
+}
+
+const int MapGenerator::kPerfect;
+const int MapGenerator::kBraided;
+const int MapGenerator::kRooms;
+const int MapGenerator::kWarehouse;
+
+MapGenerator::MapGenerator(const MapOptions &options) : options_{options} {}
+
+int MapGenerator::KindOf(const std::string &name) {
+    if (name == "perfect")
+        return kPerfect;
+    if (name == "braided")
+        return kBraided;
+    if (name == "rooms")
+        return kRooms;
+    if (name == "warehouse")
+        return kWarehouse;
+    return -1;
+}
+
+bool MapGenerator::Generate(const int &kind, BitGrid &grid) const {
+    if (kind < kPerfect || kind > kWarehouse || options_.length < 3 || options_.width < 3)
+        return false;
+    grid = BitGrid(options_.length, options_.width);
+    if (kind == kPerfect || kind == kBraided)
+        GenerateMaze(grid, kind == kBraided);
+    else if (kind == kRooms)
+        GenerateRooms(grid);
+    else
+        GenerateWarehouse(grid);
+    return true;
+}
+
+void MapGenerator::GenerateMaze(BitGrid &grid, const bool &is_braided) const {
+    // Maze cell (cx, cy) is grid cell (2cx + 1, 2cy + 1), the walls lie in between
+    const int columns = (options_.length - 1) / 2;
+    const int rows = (options_.width - 1) / 2;
+    const int stripes = (rows + kStripeRows - 1) / kStripeRows;
+    const int *const dx = BitGrid::kMoveX;
+    const int *const dy = BitGrid::kMoveY;
+    ParallelFor(stripes, options_.threads, 1, [&](int stripe, int, int) {
+        const int row0 = stripe * kStripeRows;
+        const int row1 = std::min(rows, row0 + kStripeRows);
+        Random random(options_.seed, static_cast<std::uint64_t>(stripe));
+        const auto is_carved = [&grid](const int &cx, const int &cy) {
+            return grid.IsNotObstacle(std::make_pair(2 * cx + 1, 2 * cy + 1));
+        };
+        // Randomized depth first search over the cells of the stripe
+        std::vector<std::pair<int, int>> stack;
+        stack.emplace_back(static_cast<int>(random.Below(static_cast<std::uint32_t>(columns))),
+                           row0 + static_cast<int>(random.Below(static_cast<std::uint32_t>(row1 - row0))));
+        grid.SetFree(2 * stack.back().first + 1, 2 * stack.back().second + 1, true);
+        while (!stack.empty()) {
+            const std::pair<int, int> cell = stack.back();
+            int options[4];
+            int count = 0;
+            for (int d = 0; d < 4; d++) {
+                const int nx = cell.first + dx[d];
+                const int ny = cell.second + dy[d];
+                if (nx >= 0 && nx < columns && ny >= row0 && ny < row1 && !is_carved(nx, ny))
+                    options[count++] = d;
+            }
+            if (count == 0) {
+                stack.pop_back();
+                continue;
+            }
+            const int d = options[random.Below(static_cast<std::uint32_t>(count))];
+            grid.SetFree(2 * cell.first + 1 + dx[d], 2 * cell.second + 1 + dy[d], true);
+            grid.SetFree(2 * (cell.first + dx[d]) + 1, 2 * (cell.second + dy[d]) + 1, true);
+            stack.emplace_back(cell.first + dx[d], cell.second + dy[d]);
+        }
+        if (!is_braided)
+            return;
+        // Open dead ends into a neighbour, without touching the rows between stripes
+        for (int cy = row0; cy < row1; cy++) {
+            for (int cx = 0; cx < columns; cx++) {
+                int walls[4];
+                int closed = 0;
+                for (int d = 0; d < 4; d++) {
+                    const int nx = cx + dx[d];
+                    const int ny = cy + dy[d];
+                    if (nx < 0 || nx >= columns || ny < row0 || ny >= row1)
+                        continue;
+                    if (!grid.IsNotObstacle(std::make_pair(2 * cx + 1 + dx[d], 2 * cy + 1 + dy[d])))
+                        walls[closed++] = d;
+                }
+                const int open = (cx > 0) + (cx + 1 < columns) + (cy > row0) + (cy + 1 < row1) - closed;
+                if (open != 1 || closed == 0 || random.Uniform() >= options_.braid)
+                    continue;
+                const int d = walls[random.Below(static_cast<std::uint32_t>(closed))];
+                grid.SetFree(2 * cx + 1 + dx[d], 2 * cy + 1 + dy[d], true);
+            }
+        }
+    });
+    // One opening between consecutive stripes keeps the maze a spanning tree
+    Random random(options_.seed, static_cast<std::uint64_t>(stripes));
+    for (int stripe = 1; stripe < stripes; stripe++) {
+        const int cx = static_cast<int>(random.Below(static_cast<std::uint32_t>(columns)));
+        grid.SetFree(2 * cx + 1, 2 * stripe * kStripeRows, true);
+    }
+}
+
+void MapGenerator::GenerateRooms(BitGrid &grid) const {
+    const int sectors_x = (options_.length + kSectorSize - 1) / kSectorSize;
+    const int sectors_y = (options_.width + kSectorSize - 1) / kSectorSize;
+    const int room_min = std::max(1, options_.room_min);
+    const int room_max = std::max(room_min, options_.room_max);
+    std::vector<std::pair<int, int>> anchors(static_cast<std::size_t>(sectors_x) * sectors_y);
+    ParallelFor(sectors_x * sectors_y, options_.threads, 1, [&](int sector, int, int) {
+        // Free space of the sector, keeping the outer wall of the map
+        const int x0 = std::max(1, (sector % sectors_x) * kSectorSize);
+        const int y0 = std::max(1, (sector / sectors_x) * kSectorSize);
+        const int x1 = std::min(options_.length - 1, (sector % sectors_x + 1) * kSectorSize);
+        const int y1 = std::min(options_.width - 1, (sector / sectors_x + 1) * kSectorSize);
+        Random random(options_.seed, static_cast<std::uint64_t>(sector));
+        std::vector<std::array<int, 4>> rooms;
+        const int attempts = 8 + 4 * (x1 - x0) * (y1 - y0) / (room_max * room_max);
+        for (int attempt = 0; attempt < attempts; attempt++) {
+            const int w = std::min(room_min + static_cast<int>(random.Below(room_max - room_min + 1)), x1 - x0);
+            const int h = std::min(room_min + static_cast<int>(random.Below(room_max - room_min + 1)), y1 - y0);
+            if (w < 1 || h < 1)
+                break;
+            const int x = x0 + static_cast<int>(random.Below(static_cast<std::uint32_t>(x1 - x0 - w + 1)));
+            const int y = y0 + static_cast<int>(random.Below(static_cast<std::uint32_t>(y1 - y0 - h + 1)));
+            // Rooms keep a wall between them. Only the rooms are carved so far, so a free cell
+            // around the candidate means an overlap (the check stays inside the sector)
+            bool is_overlapping = false;
+            for (int ry = std::max(y0, y - 1); ry < std::min(y1, y + h + 1) && !is_overlapping; ry++) {
+                for (int rx = std::max(x0, x - 1); rx < std::min(x1, x + w + 1) && !is_overlapping; rx++)
+                    is_overlapping = grid.IsNotObstacle(std::make_pair(rx, ry));
+            }
+            if (is_overlapping)
+                continue;
+            rooms.push_back({x, y, w, h});
+            for (int ry = y; ry < y + h; ry++) {
+                for (int rx = x; rx < x + w; rx++)
+                    grid.SetFree(rx, ry, true);
+            }
+        }
+        const auto center = [](const std::array<int, 4> &room) {
+            return std::make_pair(room[0] + room[2] / 2, room[1] + room[3] / 2);
+        };
+        for (std::size_t i = 1; i < rooms.size(); i++)
+            CarveCorridor(grid, center(rooms[i - 1]), center(rooms[i]));
+        anchors[sector] = rooms.empty() ? std::make_pair((x0 + x1 - 1) / 2, (y0 + y1 - 1) / 2) : center(rooms[0]);
+        grid.SetFree(anchors[sector].first, anchors[sector].second, true);
+    });
+    // Join every sector to its East and South neighbours
+    for (int sy = 0; sy < sectors_y; sy++) {
+        for (int sx = 0; sx < sectors_x; sx++) {
+            const std::pair<int, int> &anchor = anchors[sy * sectors_x + sx];
+            if (sx + 1 < sectors_x)
+                CarveCorridor(grid, anchor, anchors[sy * sectors_x + sx + 1]);
+            if (sy + 1 < sectors_y)
+                CarveCorridor(grid, anchor, anchors[(sy + 1) * sectors_x + sx]);
+        }
+    }
+}
+
+void MapGenerator::GenerateWarehouse(BitGrid &grid) const {
+    const int aisle = std::max(1, options_.aisle_width);
+    const int rack_length = std::max(1, options_.rack_length);
+    const int inner_length = options_.length - 2;
+    const int inner_width = options_.width - 2;
+    const int stripes = (options_.width + kWarehouseRows - 1) / kWarehouseRows;
+    ParallelFor(stripes, options_.threads, 1, [&](int stripe, int, int) {
+        const int y0 = std::max(1, stripe * kWarehouseRows);
+        const int y1 = std::min(options_.width - 1, (stripe + 1) * kWarehouseRows);
+        for (int y = y0; y < y1; y++) {
+            const int iy = y - 1;
+            const bool is_row_aisle = iy < aisle || iy >= inner_width - aisle ||
+                                      (iy - aisle) % (rack_length + aisle) >= rack_length;
+            for (int x = 1; x < options_.length - 1; x++) {
+                const int ix = x - 1;
+                // Racks are two cells deep, between aisles of the given width
+                const bool is_column_aisle = ix < aisle || ix >= inner_length - aisle ||
+                                             (ix - aisle) % (aisle + 2) >= 2;
+                if (is_row_aisle || is_column_aisle)
+                    grid.SetFree(x, y, true);
+            }
+        }
+    });
+}
@@ -27,12 +27,20 @@
  */
 
 #include <array>
+#include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <stack>
 #include <utility>
 #include <memory>
+#include <vector>
+#include "../include/CommandRing.h"
 #include "../include/Maze.h"
+#include "../include/Path.h"
+#include "../include/PlannerMetrics.h"
+#include "../include/SearchTracer.h"
+#include "../include/SearchWorkspace.h"
 #include "../include/Target.h"
 #include "../include/DownState.h"
 #include "../include/UpState.h"
@@ -92,6 +100,26 @@ void Maze::ShowMaze() const {
     std::cout << "\n\n\n";
 }
 
+void Maze::set_tracer(SearchTracer *tracer) {
+    tracer_ = tracer;
+}
+
+void Maze::set_metrics(PlannerMetrics *metrics, const std::string &robot_type) {
+    action_metrics_ = metrics == nullptr ? nullptr : &metrics->Get("astar", "action", robot_type);
+    plot_metrics_ = metrics == nullptr ? nullptr : &metrics->Get("astar", "plot_trajectory", robot_type);
+    build_metrics_ = metrics == nullptr ? nullptr : &metrics->Get("astar", "build_stack", robot_type);
+}
+
+void Maze::RecordQuery(QueryMetrics *metrics, const std::chrono::steady_clock::time_point &begin,
+                       const int &status, const AllocationScope &allocations) const {
+    if (metrics == nullptr)
+        return;
+    const int length = status == 1 ? static_cast<int>(SearchWorkspace::Local().get_cost(ToIndex(goal_))) : -1;
+    metrics->Record(std::chrono::steady_clock::now() - begin, expansions_, length);
+    if (AllocationCounter::kIsEnabled)
+        metrics->RecordAllocations(allocations.get_stats());
+}
+
 std::pair<int, int> Maze::North(const std::pair<int, int> &node) const {
     return std::make_pair(node.first, node.second - 1);
 }
@@ -126,20 +154,30 @@ bool Maze::IsWithinRegion(const std::pair<int, int> &node) const {
            node.second >= 0 && node.second <= 30;
 }
 
+int Maze::ToIndex(const std::pair<int, int> &node) const {
+    return node.second * length_ + node.first;
+}
+
+std::pair<int, int> Maze::ToNode(const int &index) const {
+    return std::make_pair(index % length_, index / length_);
+}
+
 const int Maze::TakeDecision1(const std::pair<int, int> &new_node,
                               const double &cost_g,
                               ListInfo &info,
                               const std::pair<int, int> &parent_node) {
-    if (IsWithinRegion(new_node) && IsNotObstacle(new_node)) {
+    if (IsWithinRegion(new_node) && (IsNotObstacle(new_node) || new_node == goal_)) {
+        SearchWorkspace &workspace = SearchWorkspace::Local();
         info.cost_h = CalculateDistance(new_node);
         info.cost_g = cost_g + 1;
         info.total_cost = info.cost_g + info.cost_h;
         info.node = new_node;
         info.parent = parent_node;
-        priority_list_.insert(std::pair<double, ListInfo>(info.total_cost, info));
-        open_list_[info.node] = info;
+        workspace.Update(ToIndex(new_node), info.cost_g, ToIndex(parent_node));
+        workspace.Push(info.total_cost, ToIndex(new_node));
+        MAZE_TRACE(tracer_, Generate(ToIndex(new_node), info.cost_g, info.cost_h, workspace.get_open_size()));
         if (new_node == goal_) {
-            closed_list_[new_node] = info;
+            workspace.Close(ToIndex(new_node));
             return 1;
         } else
             return -1;
@@ -151,53 +189,41 @@ const int Maze::TakeDecision2(const std::pair<int, int> &new_node,
                               const double &cost_g,
                               ListInfo &info,
                               const std::pair<int, int> &parent_node) {
+    if (!IsWithinRegion(new_node))
+        return -1;
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    const int index = ToIndex(new_node);
     //< If the node is already there in closed list, then skip
-    if (closed_list_.find(new_node) != closed_list_.end()) {
+    if (workspace.IsClosed(index)) {
         if (new_node == goal_)
             return 1;
         else
             return -1;
     }
         //< If the new node is already there in open and priority lists
-    else if (IsWithinRegion(new_node) && IsNotObstacle(new_node)) {
-        if (open_list_.find(new_node) != open_list_.end()) {
-            info.cost_h = CalculateDistance(new_node);
-            info.cost_g = cost_g + 1;
-            info.total_cost = info.cost_g + info.cost_h;
-            info.node = new_node;
-            info.parent = parent_node;
-            ListInfo value = open_list_.find(new_node)->second;
-            if (value.cost_g > info.cost_g) {
-                open_list_.find(new_node)->second.cost_g = info.cost_g;
-                open_list_.find(new_node)->second.cost_h = info.cost_h;
-                open_list_.find(new_node)->second.total_cost = info.total_cost;
-                open_list_.find(new_node)->second.parent = info.parent;
-                auto it_range = priority_list_.equal_range(value.total_cost);
-                for (auto itr = it_range.first; itr != it_range.second; ++itr) {
-                    if (itr->second.node == new_node) {
-                        itr->second.cost_g = info.cost_g;
-                        itr->second.cost_h = info.cost_h;
-                        itr->second.total_cost = info.total_cost;
-                        itr->second.parent = info.parent;
-                        break;
-                    }
-                }
+    else if (IsNotObstacle(new_node) || new_node == goal_) {
+        info.cost_h = CalculateDistance(new_node);
+        info.cost_g = cost_g + 1;
+        info.total_cost = info.cost_g + info.cost_h;
+        info.node = new_node;
+        info.parent = parent_node;
+        if (workspace.IsSeen(index)) {
+            // A cheaper way to an open node is pushed again; the outdated entry is
+            // skipped when it reaches the top of the priority list
+            if (workspace.get_cost(index) > info.cost_g) {
+                workspace.Update(index, info.cost_g, ToIndex(parent_node));
+                workspace.Push(info.total_cost, index);
+                MAZE_TRACE(tracer_, Generate(index, info.cost_g, info.cost_h, workspace.get_open_size()));
             }
             return -1;
         } else { // If key could not be found in open list, then do the following --
-            // Note: Even though priority list does not have key, it may have the same
-            // cost f for a different key
-            info.cost_h = CalculateDistance(new_node);
-            info.cost_g = cost_g + 1;
-            info.total_cost = info.cost_g + info.cost_h;
-            info.node = new_node;
-            info.parent = parent_node;
+            workspace.Update(index, info.cost_g, ToIndex(parent_node));
             if (new_node == goal_) {
-                closed_list_[new_node] = info;
+                workspace.Close(index);
                 return 1;
             } else {
-                priority_list_.insert(std::pair<double, ListInfo>(info.total_cost, info));
-                open_list_[info.node] = info;
+                workspace.Push(info.total_cost, index);
+                MAZE_TRACE(tracer_, Generate(index, info.cost_g, info.cost_h, workspace.get_open_size()));
                 return -1;
             }
         }
@@ -206,6 +232,20 @@ const int Maze::TakeDecision2(const std::pair<int, int> &new_node,
 }
 
 int Maze::Action() {
+    if (action_metrics_ == nullptr)
+        return Search();
+    const auto begin = std::chrono::steady_clock::now();
+    const AllocationScope allocations;
+    const int status = Search();
+    RecordQuery(action_metrics_, begin, status, allocations);
+    return status;
+}
+
+int Maze::Search() {
+    MAZE_TRACE_SPAN(tracer_, SearchTracer::kPhaseSearch);
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    workspace.Reset(static_cast<std::size_t>(length_) * width_);
+    expansions_ = 1;
     // Initialize cost g, cost h, total cost, node no and parent no for root node
     double cost_h;
     double cost_g = 0;
@@ -220,7 +260,9 @@ int Maze::Action() {
     info.node = current_node;
     // Assume that first node was pushed and popped from priority and open lists
     // Then add it to closed list
-    closed_list_[current_node] = info;
+    workspace.Update(ToIndex(current_node), cost_g, ToIndex(current_node));
+    workspace.Close(ToIndex(current_node));
+    MAZE_TRACE(tracer_, Expand(ToIndex(current_node), cost_g, cost_h, 0));
     auto north_move = North(current_node);
     const int decision_north1 = TakeDecision1(north_move, cost_g, info, parent_node);
     if (decision_north1 == 1)
@@ -239,20 +281,22 @@ int Maze::Action() {
         return 1; // Everything fine until here
     while (true) {
         // Pop the top element from priority list  <---- If priority list empty, then break while loop
-        if (priority_list_.empty() && closed_list_.find(goal_) == closed_list_.end()) {
+        if (workspace.IsEmpty() && !workspace.IsClosed(ToIndex(goal_))) {
             return -1; // Goal node not in closed list and priority list is also empty
-        } else if (priority_list_.empty() && closed_list_.find(goal_) != closed_list_.end()) {
+        } else if (workspace.IsEmpty() && workspace.IsClosed(ToIndex(goal_))) {
             return 1; // Goal node is found in closed list and priority list is empty
         } else {
-            auto low_cost_info = priority_list_.begin()->second;
-            priority_list_.erase(priority_list_.begin());
-            auto low_cost_node = low_cost_info.node;
-            // Remove the same node from open list
-            open_list_.erase(low_cost_node);
-            closed_list_[low_cost_node] = low_cost_info;
-            current_node = low_cost_node;
-            parent_node = low_cost_node;
-            cost_g = low_cost_info.cost_g;
+            const HeapEntry low_cost_entry = workspace.Pop();
+            // Skip entries which were superseded by a cheaper push of the same node
+            if (workspace.IsClosed(low_cost_entry.state))
+                continue;
+            workspace.Close(low_cost_entry.state);
+            expansions_++;
+            current_node = ToNode(low_cost_entry.state);
+            parent_node = current_node;
+            cost_g = workspace.get_cost(low_cost_entry.state);
+            MAZE_TRACE(tracer_, Expand(low_cost_entry.state, cost_g, CalculateDistance(current_node),
+                                       workspace.get_open_size()));
             north_move = North(current_node);
             const int decision_north2 = TakeDecision2(north_move, cost_g, info, parent_node);
             if (decision_north2 == 1) {
@@ -278,48 +322,132 @@ int Maze::Action() {
     return 1;
 }
 
-int Maze::PlotTrajectory(const char &path_icon) {
-    int status = Action();
+int Maze::Action(Path &path) {
+    const int status = Action();
     if (status == 1) {
-        std::pair<int, int> node = goal_;
-        std::pair<int, int> parent = closed_list_.find(node)->second.parent;
-        while (parent != node) {
-            if (node != goal_ || node != start_) {
-                grid_[node.second][node.first] = path_icon;
-            }
-            node = closed_list_.find(parent)->second.node;
-            parent = closed_list_.find(parent)->second.parent;
-        }
-        return 0; // Return 0 for a path exists.
+        MAZE_TRACE_SPAN(tracer_, SearchTracer::kPhaseReconstruct);
+        path.Reconstruct(SearchWorkspace::Local(), ToIndex(goal_), length_);
     } else {
+        path.Clear();
+    }
+    return status;
+}
+
+int Maze::PlotTrajectory(const char &path_icon) {
+    if (plot_metrics_ == nullptr) {
+        Action(path_);
+        return PlotTrajectory(path_.View(), path_icon);
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    const AllocationScope allocations;
+    const int status = Action(path_);
+    RecordQuery(plot_metrics_, begin, status, allocations);
+    return PlotTrajectory(path_.View(), path_icon);
+}
+
+int Maze::PlotTrajectory(const PathView &path, const char &path_icon) {
+    if (path.IsEmpty())
         return 1; // Return 1 for no path exists.
+    // Every node but the start is marked, the goal included
+    for (auto node = path.begin(); node != path.end(); ++node) {
+        if (node != path.begin())
+            grid_[node->second][node->first] = path_icon;
     }
+    return 0; // Return 0 for a path exists.
 }
 
 void Maze::BuildStack(const std::shared_ptr<MobileRobot> &robot_in_maze) {
-    int status = Action();
-    if (status == 1) {
-        std::pair<int, int> node = goal_;
-        std::pair<int, int> parent = closed_list_.find(node)->second.parent;
-        while (parent != node) {
-            if (node != goal_ || node != start_) {
-                if (parent.first - node.first == 1) {
-                    robot_in_maze->HandleInput("LEFT");
-                }
-                if (parent.first - node.first == -1) {
-                    robot_in_maze->HandleInput("RIGHT");
-                }
-                if (parent.second - node.second == 1) {
-                    robot_in_maze->HandleInput("DOWN");
-                }
-                if (parent.second - node.second == -1) {
-                    robot_in_maze->HandleInput("UP");
-                }
-                node = closed_list_.find(parent)->second.node;
-                parent = closed_list_.find(parent)->second.parent;
-            }
+    if (build_metrics_ == nullptr) {
+        Action(path_);
+        BuildStack(path_.View(), robot_in_maze);
+        return;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    const AllocationScope allocations;
+    const int status = Action(path_);
+    RecordQuery(build_metrics_, begin, status, allocations);
+    BuildStack(path_.View(), robot_in_maze);
+}
+
+void Maze::BuildStack(const std::vector<std::pair<int, int>> &path,
+                      const std::shared_ptr<MobileRobot> &robot_in_maze) const {
+    if (path.empty()) {
+        std::cout << "No path for " << robot_in_maze->get_name() << std::endl;
+        return;
+    }
+    // Walk from the goal back to the start, in the same order as the parent walk above
+    for (std::size_t i = path.size() - 1; i > 0; i--) {
+        const std::pair<int, int> &node = path[i];
+        const std::pair<int, int> &parent = path[i - 1];
+        if (parent.first - node.first == 1) {
+            robot_in_maze->HandleInput("LEFT");
         }
-    } else {
+        if (parent.first - node.first == -1) {
+            robot_in_maze->HandleInput("RIGHT");
+        }
+        if (parent.second - node.second == 1) {
+            robot_in_maze->HandleInput("DOWN");
+        }
+        if (parent.second - node.second == -1) {
+            robot_in_maze->HandleInput("UP");
+        }
+    }
+}
+
+void Maze::BuildStack(const PathView &path, const std::shared_ptr<MobileRobot> &robot_in_maze) const {
+    if (path.IsEmpty()) {
         std::cout << "No path for " << robot_in_maze->get_name() << std::endl;
+        return;
+    }
+    // From the last move back to the first, in the same order as the parent walk
+    for (std::size_t i = path.get_move_count(); i > 0; i--) {
+        switch (path.get_move(i - 1)) {
+            case PathView::kUp:
+                robot_in_maze->HandleInput("UP");
+                break;
+            case PathView::kDown:
+                robot_in_maze->HandleInput("DOWN");
+                break;
+            case PathView::kLeft:
+                robot_in_maze->HandleInput("LEFT");
+                break;
+            default:
+                robot_in_maze->HandleInput("RIGHT");
+                break;
+        }
+    }
+}
+
+int Maze::StreamStack(CommandRing &ring) {
+    // Searching from the goal makes the parent of every node its next node on the path
+    std::swap(start_, goal_);
+    int status;
+    if (build_metrics_ == nullptr) {
+        status = Search();
+    } else {
+        const auto begin = std::chrono::steady_clock::now();
+        const AllocationScope allocations;
+        status = Search();
+        RecordQuery(build_metrics_, begin, status, allocations);
+    }
+    std::swap(start_, goal_);
+    if (status == 1) {
+        MAZE_TRACE_SPAN(tracer_, SearchTracer::kPhaseReconstruct);
+        const SearchWorkspace &workspace = SearchWorkspace::Local();
+        const int goal_index = ToIndex(goal_);
+        for (int index = ToIndex(start_); index != goal_index;) {
+            const int next = workspace.get_parent(index);
+            if (next == index + 1)
+                ring.Push(PathView::kRight);
+            else if (next == index - 1)
+                ring.Push(PathView::kLeft);
+            else if (next == index + length_)
+                ring.Push(PathView::kUp);
+            else
+                ring.Push(PathView::kDown);
+            index = next;
+        }
     }
+    ring.Close();
+    return status;
 }
@@ -45,24 +45,58 @@ MobileRobot::MobileRobot(std::string RobotName) {
     name_ = std::move(RobotName);
 }
 
-void WheeledRobot::HandleInput(const std::string &input) {
-    state::RobotState *state = new state::UpState();
+MobileRobot::~MobileRobot() {
+    while (!current_.empty()) {
+        delete current_.top();
+        current_.pop();
+    }
+}
+
+void MobileRobot::Execute(const std::string &input) {
+    if (current_.empty())
+        current_.push(new state::UpState());
+    current_.top()->HandleInput(current_, input);
+    if (current_.size() < 2)
+        return;
+    // The state pushed for the move replaces the state which handled it
+    state::RobotState *next = current_.top();
+    current_.pop();
+    delete current_.top();
+    current_.pop();
+    current_.push(next);
+    executed_count_++;
+}
+
+std::string MobileRobot::get_state_name() const {
+    return current_.empty() ? "Up" : current_.top()->get_name();
+}
 
+WheeledRobot::~WheeledRobot() {
+    while (!robot_stack_.empty()) {
+        delete robot_stack_.top();
+        robot_stack_.pop();
+    }
+}
+
+void WheeledRobot::HandleInput(const std::string &input) {
+    // The bottom of the stack is an initial state owned by the stack like the others
     if (robot_stack_.empty())
-        state->HandleInput(robot_stack_, input);
-    else
-        robot_stack_.top()->HandleInput(robot_stack_, input);
-    delete state;
+        robot_stack_.push(new state::UpState());
+    robot_stack_.top()->HandleInput(robot_stack_, input);
 }
 
-void TrackedRobot::HandleInput(const std::string &input) {
-    state::RobotState *state = new state::UpState();
+TrackedRobot::~TrackedRobot() {
+    while (!robot_stack_.empty()) {
+        delete robot_stack_.top();
+        robot_stack_.pop();
+    }
+}
 
+void TrackedRobot::HandleInput(const std::string &input) {
+    // The bottom of the stack is an initial state owned by the stack like the others
     if (robot_stack_.empty())
-        state->HandleInput(robot_stack_, input);
-    else
-        robot_stack_.top()->HandleInput(robot_stack_, input);
-    delete state;
+        robot_stack_.push(new state::UpState());
+    robot_stack_.top()->HandleInput(robot_stack_, input);
 }
 
 void WheeledRobot::ShowStack() {
@@ -89,7 +123,7 @@ std::string MobileRobot::get_name() {
 
 // UpState::UpState()
 
-void state::UpState::HandleInput(std::stack<state::RobotState *> &stack_,
+void state::UpState::HandleInput(state::StateStack &stack_,
                                  const std::string &input) {
     if (stack_.empty()) {
         stack_.push(this);
@@ -112,7 +146,7 @@ void state::UpState::HandleInput(std::stack<state::RobotState *> &stack_,
     }
 }
 
-void state::DownState::HandleInput(std::stack<state::RobotState *> &stack_,
+void state::DownState::HandleInput(state::StateStack &stack_,
                                    const std::string &input) {
     if (stack_.empty()) {
         stack_.push(this);
@@ -135,7 +169,7 @@ void state::DownState::HandleInput(std::stack<state::RobotState *> &stack_,
     }
 }
 
-void state::LeftState::HandleInput(std::stack<RobotState *> &stack_,
+void state::LeftState::HandleInput(StateStack &stack_,
                                    const std::string &input) {
     if (stack_.empty()) {
         stack_.push(this);
@@ -158,7 +192,7 @@ void state::LeftState::HandleInput(std::stack<RobotState *> &stack_,
     }
 }
 
-void state::RightState::HandleInput(std::stack<state::RobotState *> &stack_,
+void state::RightState::HandleInput(state::StateStack &stack_,
                                     const std::string &input) {
     if (stack_.empty()) {
         stack_.push(this);
@@ -0,0 +1,56 @@
+/*
+ * @file        ParallelFor.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file ParallelFor.cpp contains the definitions of ParallelFor and ThreadCount
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "../include/ParallelFor.h"
+
+int ThreadCount(const int &threads) {
+    return threads > 0 ? threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+void ParallelFor(const int &count, const int &threads, const int &chunk,
+                 const std::function<void(int, int, int)> &task) {
+    const int size = std::max(chunk, 1);
+    const int chunks = (count + size - 1) / size;
+    const int workers = std::max(1, std::min(ThreadCount(threads), chunks));
+    std::atomic<int> next{0};
+    const auto work = [&](const int &worker) {
+        for (int index = next++; index < chunks; index = next++)
+            task(index * size, std::min(count, (index + 1) * size), worker);
+    };
+    std::vector<std::thread> pool;
+    for (int worker = 1; worker < workers; worker++)
+        pool.emplace_back(work, worker);
+    work(0);
+    for (auto &thread : pool)
+        thread.join();
+}
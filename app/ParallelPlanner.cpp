@@ -0,0 +1,312 @@
+/*
+ * @file        ParallelPlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file ParallelPlanner.cpp contains the definitions for ParallelPlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/ParallelPlanner.h"
+#include "../include/BitGrid.h"
+
+namespace {
+/*! \brief Number of messages sent together */
+const std::size_t kBatchSize = 64;
+
+/*! \brief Number of expansions between two looks at the inbox */
+const int kExpansionsPerRound = 64;
+
+/*! \brief Open list order: lowest total cost first, then highest cost to come */
+struct OpenOrder {
+    template<typename Entry>
+    bool operator()(const Entry &a, const Entry &b) const {
+        return a.priority > b.priority || (a.priority == b.priority && a.cost < b.cost);
+    }
+};
+}
+
+ParallelPlanner::ParallelPlanner(const BitGrid &grid, const int &threads) : grid_{grid} {
+    int count = threads > 0 ? threads : static_cast<int>(std::thread::hardware_concurrency());
+    count = std::max(count, 1);
+    std::mt19937 random(809);
+    zobrist_x_.resize(static_cast<std::size_t>(grid_.get_length() / 4 + 1));
+    zobrist_y_.resize(static_cast<std::size_t>(grid_.get_width() / 4 + 1));
+    for (auto &word : zobrist_x_)
+        word = random();
+    for (auto &word : zobrist_y_)
+        word = random();
+    for (int id = 0; id < count; id++) {
+        workers_.emplace_back(new Worker);
+        workers_.back()->outgoing.assign(static_cast<std::size_t>(count), nullptr);
+    }
+    // Every block of 16 cells goes to the arrays of its owner, so its cells share lines
+    // with cells of the same owner only
+    blocks_x_ = (grid_.get_length() + 3) / 4;
+    const int blocks_y = (grid_.get_width() + 3) / 4;
+    block_slots_.resize(static_cast<std::size_t>(blocks_x_) * static_cast<std::size_t>(blocks_y));
+    std::vector<std::size_t> sizes(workers_.size(), 0);
+    for (int y = 0; y < blocks_y; y++) {
+        for (int x = 0; x < blocks_x_; x++) {
+            std::size_t &size = sizes[static_cast<std::size_t>(OwnerOf(x << 2, y << 2))];
+            block_slots_[static_cast<std::size_t>(y * blocks_x_ + x)] = size;
+            size += 16;
+        }
+    }
+    for (std::size_t id = 0; id < workers_.size(); id++) {
+        workers_[id]->stamp.assign(sizes[id], 0);
+        workers_[id]->cost.resize(sizes[id]);
+        workers_[id]->parent.resize(sizes[id]);
+    }
+}
+
+void *ParallelPlanner::Worker::operator new(std::size_t size) {
+    void *pointer = nullptr;
+    if (posix_memalign(&pointer, alignof(Worker), size) != 0)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void ParallelPlanner::Worker::operator delete(void *pointer) {
+    std::free(pointer);
+}
+
+ParallelPlanner::~ParallelPlanner() {
+    for (auto &worker : workers_) {
+        for (Batch *batch = worker->inbox.load(); batch != nullptr;) {
+            Batch *next = batch->next;
+            delete batch;
+            batch = next;
+        }
+        for (auto &batch : worker->outgoing)
+            delete batch;
+        for (auto &batch : worker->spare)
+            delete batch;
+    }
+}
+
+std::size_t ParallelPlanner::get_expansions() const {
+    std::size_t expansions = 0;
+    for (const auto &worker : workers_)
+        expansions += worker->expansions;
+    return expansions;
+}
+
+std::size_t ParallelPlanner::get_messages() const {
+    std::size_t messages = 0;
+    for (const auto &worker : workers_)
+        messages += worker->sent;
+    return messages;
+}
+
+int ParallelPlanner::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                              std::vector<std::pair<int, int>> &path) {
+    path.clear();
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal))
+        return -1;
+    if (++epoch_ == 0) {
+        for (auto &worker : workers_)
+            std::fill(worker->stamp.begin(), worker->stamp.end(), 0);
+        epoch_ = 1;
+    }
+    goal_x_ = goal.first;
+    goal_y_ = goal.second;
+    goal_state_ = grid_.ToIndex(goal);
+    incumbent_.store(std::numeric_limits<int>::max());
+    in_flight_.store(0);
+    is_finished_.store(false);
+    for (auto &worker : workers_) {
+        worker->open.clear();
+        worker->is_idle.store(false);
+        worker->expansions = 0;
+        worker->sent = 0;
+    }
+    const int start_state = grid_.ToIndex(start);
+    Relax(OwnerOf(start.first, start.second), Message{start_state, 0, start_state});
+    // The calling thread is search thread 0
+    std::vector<std::thread> threads;
+    for (int id = 1; id < get_thread_count(); id++)
+        threads.emplace_back(&ParallelPlanner::Search, this, id);
+    Search(0);
+    for (auto &thread : threads)
+        thread.join();
+    const int moves = incumbent_.load();
+    if (moves == std::numeric_limits<int>::max())
+        return -1;
+    for (int state = goal_state_;;) {
+        const std::pair<int, int> node = grid_.ToNode(state);
+        path.push_back(node);
+        if (state == start_state)
+            break;
+        state = workers_[OwnerOf(node.first, node.second)]->parent[SlotOf(node.first, node.second)];
+    }
+    std::reverse(path.begin(), path.end());
+    return moves;
+}
+
+void ParallelPlanner::Relax(const int &id, const Message &message) {
+    Worker &worker = *workers_[id];
+    const std::pair<int, int> node = grid_.ToNode(message.state);
+    const std::size_t slot = SlotOf(node.first, node.second);
+    if (worker.stamp[slot] == epoch_ && worker.cost[slot] <= message.cost)
+        return;
+    const int priority = message.cost + std::abs(node.first - goal_x_) + std::abs(node.second - goal_y_);
+    if (priority >= incumbent_.load(std::memory_order_relaxed))
+        return; // Cannot beat the best path found so far
+    worker.stamp[slot] = epoch_;
+    worker.cost[slot] = message.cost;
+    worker.parent[slot] = message.parent;
+    if (message.state == goal_state_) {
+        int best = incumbent_.load();
+        while (message.cost < best && !incumbent_.compare_exchange_weak(best, message.cost)) {}
+        return;
+    }
+    worker.open.push_back(OpenEntry{priority, message.cost, message.state});
+    std::push_heap(worker.open.begin(), worker.open.end(), OpenOrder());
+}
+
+void ParallelPlanner::Send(const int &id, const int &owner, const Message &message) {
+    Worker &worker = *workers_[id];
+    Batch *&batch = worker.outgoing[owner];
+    if (batch == nullptr) {
+        if (worker.spare.empty()) {
+            batch = new Batch;
+            batch->messages.reserve(kBatchSize);
+        } else {
+            batch = worker.spare.back();
+            worker.spare.pop_back();
+        }
+    }
+    batch->messages.push_back(message);
+    if (batch->messages.size() < kBatchSize)
+        return;
+    // Count the messages before publishing them, so that they are never unaccounted for
+    in_flight_.fetch_add(static_cast<long>(batch->messages.size()));
+    worker.sent += batch->messages.size();
+    std::atomic<Batch *> &inbox = workers_[owner]->inbox;
+    batch->next = inbox.load(std::memory_order_relaxed);
+    while (!inbox.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                        std::memory_order_relaxed)) {}
+    batch = nullptr;
+}
+
+void ParallelPlanner::Flush(const int &id) {
+    Worker &worker = *workers_[id];
+    for (std::size_t owner = 0; owner < worker.outgoing.size(); owner++) {
+        Batch *batch = worker.outgoing[owner];
+        if (batch == nullptr || batch->messages.empty())
+            continue;
+        in_flight_.fetch_add(static_cast<long>(batch->messages.size()));
+        worker.sent += batch->messages.size();
+        std::atomic<Batch *> &inbox = workers_[owner]->inbox;
+        batch->next = inbox.load(std::memory_order_relaxed);
+        while (!inbox.compare_exchange_weak(batch->next, batch, std::memory_order_release,
+                                            std::memory_order_relaxed)) {}
+        worker.outgoing[owner] = nullptr;
+    }
+}
+
+bool ParallelPlanner::Receive(const int &id) {
+    Worker &worker = *workers_[id];
+    if (worker.inbox.load(std::memory_order_relaxed) == nullptr)
+        return false;
+    // Leave the idle state before taking the messages, see IsFinished
+    activity_.fetch_add(1);
+    worker.is_idle.store(false);
+    long received = 0;
+    for (Batch *batch = worker.inbox.exchange(nullptr, std::memory_order_acquire); batch != nullptr;) {
+        for (const auto &message : batch->messages)
+            Relax(id, message);
+        received += static_cast<long>(batch->messages.size());
+        Batch *next = batch->next;
+        batch->messages.clear();
+        worker.spare.push_back(batch);
+        batch = next;
+    }
+    in_flight_.fetch_sub(received);
+    return true;
+}
+
+bool ParallelPlanner::IsFinished() const {
+    // A thread leaves the idle state only by receiving, which bumps activity_ first, and
+    // messages are counted before they are sent. So if activity_ does not move while every
+    // thread is seen idle and nothing is in flight, no work is left anywhere.
+    const std::uint64_t activity = activity_.load();
+    for (const auto &worker : workers_) {
+        if (!worker->is_idle.load())
+            return false;
+    }
+    return in_flight_.load() == 0 && activity_.load() == activity;
+}
+
+void ParallelPlanner::Search(const int &id) {
+    Worker &worker = *workers_[id];
+    std::vector<OpenEntry> &open = worker.open;
+    while (!is_finished_.load(std::memory_order_relaxed)) {
+        Receive(id);
+        for (int round = 0; round < kExpansionsPerRound && !open.empty(); round++) {
+            std::pop_heap(open.begin(), open.end(), OpenOrder());
+            const OpenEntry entry = open.back();
+            open.pop_back();
+            const std::pair<int, int> node = grid_.ToNode(entry.state);
+            if (entry.cost != worker.cost[SlotOf(node.first, node.second)])
+                continue; // Superseded by a cheaper message
+            if (entry.priority >= incumbent_.load(std::memory_order_relaxed)) {
+                open.clear(); // Nothing left here can beat the best path
+                break;
+            }
+            worker.expansions++;
+            for (int d = 0; d < 4; d++) {
+                const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+                if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                    continue;
+                const Message message{grid_.ToIndex(next), entry.cost + 1, entry.state};
+                const int owner = OwnerOf(next.first, next.second);
+                if (owner == id)
+                    Relax(id, message);
+                else
+                    Send(id, owner, message);
+            }
+        }
+        // Partial batches go out every round so that the other threads never starve
+        Flush(id);
+        if (!open.empty() || worker.inbox.load(std::memory_order_relaxed) != nullptr)
+            continue;
+        worker.is_idle.store(true);
+        if (IsFinished()) {
+            is_finished_.store(true);
+            break;
+        }
+        std::this_thread::yield();
+    }
+}
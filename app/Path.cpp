@@ -0,0 +1,86 @@
+/*
+ * @file        Path.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file Path.cpp contains the definitions for Path class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../include/Path.h"
+#include "../include/SearchWorkspace.h"
+
+const std::uint8_t PathView::kUp;
+const std::uint8_t PathView::kDown;
+const std::uint8_t PathView::kLeft;
+const std::uint8_t PathView::kRight;
+
+/*!
+ * \brief Move code from one node to the next
+ * \param dx - change of x, -1, 0 or 1
+ * \param dy - change of y, -1, 0 or 1
+ * \return move code
+ * */
+static std::uint8_t MoveOf(const int &dx, const int &dy) {
+    return dx > 0 ? PathView::kRight : dx < 0 ? PathView::kLeft : dy > 0 ? PathView::kUp : PathView::kDown;
+}
+
+void Path::Clear() {
+    moves_ = 0;
+    start_ = std::make_pair(-1, -1);
+}
+
+void Path::Resize(const std::size_t &moves) {
+    moves_ = moves;
+    words_.assign((moves + 31) / 32, 0);
+}
+
+void Path::Reconstruct(const SearchWorkspace &workspace, const int &goal_cell, const int &length) {
+    std::size_t moves = 0;
+    int cell = goal_cell;
+    for (; workspace.get_parent(cell) != cell; cell = workspace.get_parent(cell))
+        moves++;
+    Resize(moves);
+    start_ = std::make_pair(cell % length, cell / length);
+    cell = goal_cell;
+    for (std::size_t index = moves; index > 0; index--) {
+        const int parent = workspace.get_parent(cell);
+        SetMove(index - 1, MoveOf(cell % length - parent % length, cell / length - parent / length));
+        cell = parent;
+    }
+}
+
+void Path::Assign(const std::vector<std::pair<int, int>> &nodes) {
+    if (nodes.empty()) {
+        Clear();
+        return;
+    }
+    Resize(nodes.size() - 1);
+    start_ = nodes.front();
+    for (std::size_t i = 1; i < nodes.size(); i++)
+        SetMove(i - 1, MoveOf(nodes[i].first - nodes[i - 1].first, nodes[i].second - nodes[i - 1].second));
+}
@@ -0,0 +1,275 @@
+/*
+ * @file        PathDatabase.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file PathDatabase.cpp contains the definitions for PathDatabase class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/ParallelFor.h"
+#include "../include/PathDatabase.h"
+
+/*! \brief Displacement of every move code, indexed by kMove value: the runs store these
+ * codes, so this order is part of the file format and is not the BitGrid order */
+static const int kMoveX[4] = {0, 0, -1, 1};
+static const int kMoveY[4] = {1, -1, 0, 0};
+
+const int PathDatabase::kMoveUp;
+const int PathDatabase::kMoveDown;
+const int PathDatabase::kMoveLeft;
+const int PathDatabase::kMoveRight;
+
+int PathDatabase::RankOf(const std::pair<int, int> &node) const {
+    if (node.first < 0 || node.first >= length_ || node.second < 0 || node.second >= width_)
+        return -1;
+    return rank_[static_cast<std::size_t>(node.second) * length_ + node.first];
+}
+
+void PathDatabase::RankCells(const BitGrid &grid) {
+    length_ = grid.get_length();
+    width_ = grid.get_width();
+    rank_.assign(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    cells_.clear();
+    component_.clear();
+    std::vector<int> stack;
+    std::uint32_t component = 0;
+    for (int cell = 0; cell < grid.get_cell_count(); cell++) {
+        if (rank_[cell] >= 0 || !grid.IsNotObstacle(grid.ToNode(cell)))
+            continue;
+        // Depth first numbering, so that ranks follow corridors
+        stack.push_back(cell);
+        while (!stack.empty()) {
+            const int current = stack.back();
+            stack.pop_back();
+            if (rank_[current] >= 0)
+                continue;
+            rank_[current] = static_cast<int>(cells_.size());
+            cells_.push_back(static_cast<std::uint32_t>(current));
+            component_.push_back(component);
+            const std::pair<int, int> node = grid.ToNode(current);
+            for (int d = 3; d >= 0; d--) {
+                const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+                if (grid.IsWithinRegion(next) && grid.IsNotObstacle(next) && rank_[grid.ToIndex(next)] < 0)
+                    stack.push_back(grid.ToIndex(next));
+            }
+        }
+        component++;
+    }
+}
+
+void PathDatabase::BuildRow(const int &source, std::vector<std::int8_t> &first, std::vector<int> &queue,
+                            std::vector<std::uint32_t> &row) const {
+    std::fill(first.begin(), first.end(), -1);
+    queue.clear();
+    queue.push_back(source);
+    first[source] = 4; // Reached, with no move of its own
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        const int current = queue[head];
+        const int cell = static_cast<int>(cells_[current]);
+        const std::pair<int, int> node{cell % length_, cell / length_};
+        for (int move = 0; move < 4; move++) {
+            const int next = RankOf(std::make_pair(node.first + kMoveX[move], node.second + kMoveY[move]));
+            if (next < 0 || first[next] >= 0)
+                continue;
+            // Every target inherits the first move of the cell it was reached from
+            first[next] = static_cast<std::int8_t>(current == source ? move : first[current]);
+            queue.push_back(next);
+        }
+    }
+    row.clear();
+    for (std::size_t target = 0; target < cells_.size(); target++) {
+        const int move = first[target];
+        // Unreachable targets and the source itself match any run
+        if (move < 0 || move == 4)
+            continue;
+        if (row.empty())
+            row.push_back(static_cast<std::uint32_t>(move));
+        else if (static_cast<int>(row.back() & 3u) != move)
+            row.push_back(static_cast<std::uint32_t>(target) << 2 | static_cast<std::uint32_t>(move));
+    }
+}
+
+std::size_t PathDatabase::Build(const BitGrid &grid, const int &threads) {
+    RankCells(grid);
+    const int sources = static_cast<int>(cells_.size());
+    std::vector<std::vector<std::uint32_t>> rows(cells_.size());
+    // Search scratch of every thread, sized by the thread on first use
+    std::vector<std::vector<std::int8_t>> first(static_cast<std::size_t>(ThreadCount(threads)));
+    std::vector<std::vector<int>> queue(first.size());
+    ParallelFor(sources, threads, 1, [&](int source, int, int worker) {
+        if (first[worker].empty()) {
+            first[worker].resize(cells_.size());
+            queue[worker].reserve(cells_.size());
+        }
+        BuildRow(source, first[worker], queue[worker], rows[source]);
+    });
+    row_start_.clear();
+    runs_.clear();
+    for (auto &row : rows) {
+        row_start_.push_back(static_cast<std::uint32_t>(runs_.size()));
+        runs_.insert(runs_.end(), row.begin(), row.end());
+        std::vector<std::uint32_t>().swap(row);
+    }
+    row_start_.push_back(static_cast<std::uint32_t>(runs_.size()));
+    return runs_.size();
+}
+
+int PathDatabase::FirstMove(const std::pair<int, int> &source, const std::pair<int, int> &target) const {
+    const int from = RankOf(source);
+    const int to = RankOf(target);
+    if (from < 0 || to < 0 || from == to || component_[from] != component_[to])
+        return -1;
+    const auto begin = runs_.begin() + row_start_[from];
+    const auto end = runs_.begin() + row_start_[from + 1];
+    if (begin == end)
+        return -1;
+    // Last run starting at or before the target
+    const auto run = std::upper_bound(begin, end, static_cast<std::uint32_t>(to) << 2 | 3u) - 1;
+    return static_cast<int>(*run & 3u);
+}
+
+int PathDatabase::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                           std::vector<std::pair<int, int>> &path) const {
+    path.clear();
+    const int from = RankOf(start);
+    const int to = RankOf(goal);
+    if (from < 0 || to < 0 || component_[from] != component_[to])
+        return -1;
+    std::pair<int, int> node = start;
+    path.push_back(node);
+    while (node != goal) {
+        // A shortest path visits every cell at most once
+        const int move = FirstMove(node, goal);
+        if (move < 0 || path.size() > cells_.size()) {
+            path.clear();
+            return -1;
+        }
+        node.first += kMoveX[move];
+        node.second += kMoveY[move];
+        path.push_back(node);
+    }
+    return static_cast<int>(path.size()) - 1;
+}
+
+std::size_t PathDatabase::get_bytes() const {
+    return sizeof(PathDatabaseHeader) +
+           sizeof(std::uint32_t) * (cells_.size() + component_.size() + row_start_.size() + runs_.size());
+}
+
+bool PathDatabase::Save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cout << "Save path database failed, cannot open " << path << std::endl;
+        return false;
+    }
+    PathDatabaseHeader header;
+    header.length = static_cast<std::uint32_t>(length_);
+    header.width = static_cast<std::uint32_t>(width_);
+    header.free_cells = static_cast<std::uint32_t>(cells_.size());
+    header.run_count = static_cast<std::uint32_t>(runs_.size());
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const auto *words : {&cells_, &component_, &row_start_, &runs_})
+        file.write(reinterpret_cast<const char *>(words->data()),
+                   static_cast<std::streamsize>(words->size() * sizeof(std::uint32_t)));
+    if (!file) {
+        std::cout << "Save path database failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool PathDatabase::Load(const std::string &path, const BitGrid &grid) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Load path database failed, cannot open " << path << std::endl;
+        return false;
+    }
+    PathDatabaseHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || std::string(header.magic, 4) != "MZPD" || header.version != 1) {
+        std::cout << "Load path database failed, " << path << " is not a path database" << std::endl;
+        return false;
+    }
+    if (static_cast<int>(header.length) != grid.get_length() ||
+        static_cast<int>(header.width) != grid.get_width()) {
+        std::cout << "Load path database failed, " << path << " was built for another map" << std::endl;
+        return false;
+    }
+    // Every free cell of the map must be covered, or the map has changed. The counts of
+    // the header are checked before they size anything, against the map and the file
+    std::size_t free_cells = 0;
+    for (int cell = 0; cell < grid.get_cell_count(); cell++)
+        free_cells += grid.IsNotObstacle(grid.ToNode(cell)) ? 1 : 0;
+    file.seekg(0, std::ios::end);
+    const auto file_bytes = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(sizeof(header));
+    const std::uint64_t expected_bytes = sizeof(header) + sizeof(std::uint32_t) *
+            (3 * static_cast<std::uint64_t>(header.free_cells) + 1 + header.run_count);
+    if (header.free_cells != free_cells || file_bytes != expected_bytes) {
+        std::cout << "Load path database failed, " << path << " does not match the map" << std::endl;
+        return false;
+    }
+    cells_.resize(header.free_cells);
+    component_.resize(header.free_cells);
+    row_start_.resize(header.free_cells + std::size_t{1});
+    runs_.resize(header.run_count);
+    for (auto *words : {&cells_, &component_, &row_start_, &runs_})
+        file.read(reinterpret_cast<char *>(words->data()),
+                  static_cast<std::streamsize>(words->size() * sizeof(std::uint32_t)));
+    length_ = grid.get_length();
+    width_ = grid.get_width();
+    rank_.assign(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    bool is_valid = static_cast<bool>(file) && row_start_.front() == 0 && row_start_.back() == header.run_count &&
+                    std::is_sorted(row_start_.begin(), row_start_.end());
+    for (std::size_t rank = 0; is_valid && rank < cells_.size(); rank++) {
+        const int cell = static_cast<int>(cells_[rank]);
+        is_valid = cell < grid.get_cell_count() && grid.IsNotObstacle(grid.ToNode(cell)) && rank_[cell] < 0;
+        if (is_valid)
+            rank_[cell] = static_cast<int>(rank);
+        // Components are numbered in rank order, each one a block of ranks
+        const std::uint32_t component = component_[rank];
+        is_valid = is_valid && (rank == 0 ? component == 0 : component == component_[rank - 1] ||
+                                                             component == component_[rank - 1] + 1);
+        // Runs start at target 0 and their targets are ranks, in increasing order
+        for (std::uint32_t run = row_start_[rank]; is_valid && run < row_start_[rank + 1]; run++) {
+            const std::uint32_t target = runs_[run] >> 2;
+            is_valid = target < header.free_cells &&
+                       (run == row_start_[rank] ? target == 0 : target > runs_[run - 1] >> 2);
+        }
+    }
+    if (!is_valid) {
+        std::cout << "Load path database failed, " << path << " does not match the map" << std::endl;
+        cells_.clear();
+        rank_.clear();
+        return false;
+    }
+    return true;
+}
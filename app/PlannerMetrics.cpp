@@ -0,0 +1,259 @@
+/*
+ * @file        PlannerMetrics.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file PlannerMetrics.cpp contains the definitions for Histogram, QueryMetrics
+ *              and PlannerMetrics classes
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/PlannerMetrics.h"
+
+/*! \brief Sub-buckets per power of two, as a number of bits */
+static const int kSubBucketBits = 5;
+
+/*! \brief Number of buckets: 64 exact ones, then 32 per power of two up to 2^64 */
+static const std::size_t kBucketCount = 64 + (64 - kSubBucketBits - 1) * (std::size_t{1} << kSubBucketBits);
+
+/*! \brief Quantiles exported for every histogram */
+static const double kQuantiles[] = {0.5, 0.9, 0.99, 0.999};
+
+Histogram::Histogram() : buckets_{new std::atomic<std::uint64_t>[kBucketCount]} {
+    for (std::size_t bucket = 0; bucket < kBucketCount; bucket++)
+        buckets_[bucket].store(0, std::memory_order_relaxed);
+}
+
+std::size_t Histogram::BucketOf(const std::uint64_t &value) {
+    if (value < 64)
+        return static_cast<std::size_t>(value);
+    int top_bit = 63;
+    while (((value >> top_bit) & 1u) == 0)
+        top_bit--;
+    // Keep the 6 leading bits: the value is (32..63) << shift
+    const int shift = top_bit - kSubBucketBits;
+    return static_cast<std::size_t>(shift) * 32 + static_cast<std::size_t>(value >> shift);
+}
+
+std::uint64_t Histogram::UpperBound(const std::size_t &bucket) {
+    if (bucket < 64)
+        return bucket;
+    const std::size_t shift = bucket / 32 - 1;
+    const std::uint64_t leading = bucket - shift * 32;
+    return ((leading + 1) << shift) - 1;
+}
+
+void Histogram::Record(const std::uint64_t &value) {
+    buckets_[BucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    std::uint64_t max = max_.load(std::memory_order_relaxed);
+    while (value > max && !max_.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+}
+
+std::uint64_t Histogram::ValueAtQuantile(const double &quantile) const {
+    std::uint64_t total = 0;
+    for (std::size_t bucket = 0; bucket < kBucketCount; bucket++)
+        total += buckets_[bucket].load(std::memory_order_relaxed);
+    if (total == 0)
+        return 0;
+    const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+            std::ceil(std::min(std::max(quantile, 0.0), 1.0) * static_cast<double>(total))));
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < kBucketCount; bucket++) {
+        seen += buckets_[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank)
+            return std::min(UpperBound(bucket), get_max());
+    }
+    return get_max();
+}
+
+void QueryMetrics::Record(const std::chrono::nanoseconds &elapsed, const std::uint64_t &expanded,
+                          const int &length) {
+    latency.Record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, elapsed.count())));
+    expansions.Record(expanded);
+    if (length >= 0)
+        path_length.Record(static_cast<std::uint64_t>(length));
+    else
+        failures.fetch_add(1, std::memory_order_relaxed);
+}
+
+void QueryMetrics::RecordAllocations(const AllocationStats &stats) {
+    allocations.Record(stats.allocations);
+    allocated_bytes.Record(stats.bytes);
+    peak_live_bytes.Record(static_cast<std::uint64_t>(std::max<std::int64_t>(0, stats.peak_live_bytes)));
+}
+
+/*!
+ * \brief Escapes a Prometheus label value
+ * \param value - raw value
+ * \return value with backslashes, quotes and new lines escaped
+ * */
+static std::string EscapeLabel(const std::string &value) {
+    std::string escaped;
+    for (const char &c : value) {
+        if (c == '\\' || c == '"')
+            escaped += '\\';
+        if (c == '\n')
+            escaped += "\\n";
+        else
+            escaped += c;
+    }
+    return escaped;
+}
+
+/*!
+ * \brief Appends one histogram as a Prometheus summary
+ * \param text - output
+ * \param name - metric name
+ * \param labels - formatted labels, without braces
+ * \param histogram - histogram to write
+ * \param scale - factor applied to the values, e.g. 1e-9 for nanoseconds to seconds
+ * */
+static void AppendSummary(std::ostringstream &text, const std::string &name, const std::string &labels,
+                          const Histogram &histogram, const double &scale) {
+    for (const double &quantile : kQuantiles)
+        text << name << "{" << labels << ",quantile=\"" << quantile << "\"} "
+             << static_cast<double>(histogram.ValueAtQuantile(quantile)) * scale << "\n";
+    text << name << "_sum{" << labels << "} " << static_cast<double>(histogram.get_sum()) * scale << "\n";
+    text << name << "_count{" << labels << "} " << histogram.get_count() << "\n";
+}
+
+PlannerMetrics::~PlannerMetrics() {
+    StopPeriodicDump();
+}
+
+QueryMetrics &PlannerMetrics::Get(const std::string &engine, const std::string &operation,
+                                  const std::string &robot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &entry : entries_) {
+        if (entry->engine == engine && entry->operation == operation && entry->robot == robot)
+            return entry->metrics;
+    }
+    entries_.emplace_back(new Entry);
+    entries_.back()->engine = engine;
+    entries_.back()->operation = operation;
+    entries_.back()->robot = robot;
+    return entries_.back()->metrics;
+}
+
+std::string PlannerMetrics::ToPrometheusText() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> labels;
+    for (const auto &entry : entries_)
+        labels.push_back("engine=\"" + EscapeLabel(entry->engine) + "\",operation=\"" +
+                         EscapeLabel(entry->operation) + "\",robot=\"" + EscapeLabel(entry->robot) + "\"");
+    std::ostringstream text;
+    text.precision(9);
+    // One block per metric family, as the format requires
+    text << "# HELP maze_query_latency_seconds Time taken by a planning query.\n"
+         << "# TYPE maze_query_latency_seconds summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_query_latency_seconds", labels[i], entries_[i]->metrics.latency, 1e-9);
+    text << "# HELP maze_query_expansions Nodes expanded by a planning query.\n"
+         << "# TYPE maze_query_expansions summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_query_expansions", labels[i], entries_[i]->metrics.expansions, 1);
+    text << "# HELP maze_path_length_moves Number of moves of the paths found.\n"
+         << "# TYPE maze_path_length_moves summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_path_length_moves", labels[i], entries_[i]->metrics.path_length, 1);
+    text << "# HELP maze_query_failures_total Planning queries which found no path.\n"
+         << "# TYPE maze_query_failures_total counter\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        text << "maze_query_failures_total{" << labels[i] << "} "
+             << entries_[i]->metrics.failures.load(std::memory_order_relaxed) << "\n";
+    if (!AllocationCounter::kIsEnabled)
+        return text.str();
+    text << "# HELP maze_query_allocations Allocations made by a planning query.\n"
+         << "# TYPE maze_query_allocations summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_query_allocations", labels[i], entries_[i]->metrics.allocations, 1);
+    text << "# HELP maze_query_allocated_bytes Bytes allocated by a planning query.\n"
+         << "# TYPE maze_query_allocated_bytes summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_query_allocated_bytes", labels[i], entries_[i]->metrics.allocated_bytes, 1);
+    text << "# HELP maze_query_peak_live_bytes Peak of the bytes held during a planning query.\n"
+         << "# TYPE maze_query_peak_live_bytes summary\n";
+    for (std::size_t i = 0; i < entries_.size(); i++)
+        AppendSummary(text, "maze_query_peak_live_bytes", labels[i], entries_[i]->metrics.peak_live_bytes, 1);
+    return text.str();
+}
+
+bool PlannerMetrics::WriteTextFile(const std::string &path) const {
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::trunc);
+        if (!file) {
+            std::cout << "Write metrics failed, cannot open " << temporary << std::endl;
+            return false;
+        }
+        file << ToPrometheusText();
+        if (!file) {
+            std::cout << "Write metrics failed, cannot write " << temporary << std::endl;
+            return false;
+        }
+    }
+    // rename replaces the old file in one step, readers see the old or the new file
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        std::cout << "Write metrics failed, cannot rename " << temporary << std::endl;
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+void PlannerMetrics::StartPeriodicDump(const std::string &path, const std::chrono::milliseconds &interval) {
+    StopPeriodicDump();
+    is_dump_stopping_ = false;
+    dump_thread_ = std::thread([this, path, interval]() {
+        std::unique_lock<std::mutex> lock(dump_mutex_);
+        while (!dump_wake_.wait_for(lock, interval, [this]() { return is_dump_stopping_; }))
+            WriteTextFile(path);
+        WriteTextFile(path);
+    });
+}
+
+void PlannerMetrics::StopPeriodicDump() {
+    if (!dump_thread_.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(dump_mutex_);
+        is_dump_stopping_ = true;
+    }
+    dump_wake_.notify_all();
+    dump_thread_.join();
+}
@@ -0,0 +1,361 @@
+/*
+ * @file        PlannerServer.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file PlannerServer.cpp contains the definitions for PlannerServer class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/PlannerMetrics.h"
+#include "../include/PlannerServer.h"
+#include "../include/SnapshotStore.h"
+#include "../include/TiledMap.h"
+#include "../include/Wavefront.h"
+
+/*!
+ * \brief Switches a socket to non-blocking mode
+ * \param fd - socket descriptor
+ * \return true if the flag was set
+ * */
+static bool SetNonBlocking(const int &fd) {
+    const int flags = fcntl(fd, F_GETFL, 0);
+    return flags >= 0 && fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+const std::size_t PlannerServer::kMaxInputBytes;
+
+PlannerServer::PlannerServer(const BitGrid &grid, const int &cached_goals)
+        : wavefront_{new Wavefront(grid)}, cached_goals_{static_cast<std::size_t>(std::max(cached_goals, 1))} {}
+
+PlannerServer::PlannerServer(const TiledMap &map, const int &cached_goals)
+        : wavefront_{new Wavefront(map)}, cached_goals_{static_cast<std::size_t>(std::max(cached_goals, 1))} {}
+
+PlannerServer::PlannerServer(const SnapshotStore &store, const int &cached_goals)
+        : store_{&store}, cached_goals_{static_cast<std::size_t>(std::max(cached_goals, 1))} {}
+
+PlannerServer::~PlannerServer() {
+    for (const auto &client : clients_)
+        close(client.fd);
+    if (listen_fd_ >= 0) {
+        close(listen_fd_);
+        unlink(socket_path_.c_str());
+    }
+}
+
+bool PlannerServer::Listen(const std::string &socket_path) {
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        std::cout << "Listen failed, socket path is too long" << std::endl;
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+        std::cout << "Listen failed, cannot create socket" << std::endl;
+        return false;
+    }
+    unlink(socket_path.c_str());
+    if (bind(listen_fd_, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0 ||
+        listen(listen_fd_, 128) != 0 || !SetNonBlocking(listen_fd_)) {
+        std::cout << "Listen failed on " << socket_path << ": " << std::strerror(errno) << std::endl;
+        close(listen_fd_);
+        listen_fd_ = -1;
+        return false;
+    }
+    socket_path_ = socket_path;
+    return true;
+}
+
+void PlannerServer::Stop() {
+    is_stopping_ = true;
+}
+
+void PlannerServer::Run() {
+    std::vector<pollfd> fds;
+    std::vector<bool> is_closed;
+    while (!is_stopping_) {
+        fds.clear();
+        fds.push_back(pollfd{listen_fd_, POLLIN, 0});
+        for (const auto &client : clients_) {
+            // A client with too many unsent replies is not read until it catches up
+            const short events = static_cast<short>((client.output.size() < max_output_bytes_ ? POLLIN : 0) |
+                                                    (client.output.empty() ? 0 : POLLOUT));
+            fds.push_back(pollfd{client.fd, events, 0});
+        }
+        // Wake up regularly so that Stop and stalled clients are noticed even without traffic
+        const int ready = poll(fds.data(), fds.size(), 100);
+        if (ready < 0 && errno != EINTR) {
+            std::cout << "Server stopped, poll failed: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        if (ready < 0)
+            continue;
+        const std::size_t polled = clients_.size();
+        is_closed.assign(polled, false);
+        for (std::size_t i = 0; i < polled; i++) {
+            if ((fds[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) != 0 && !Receive(i))
+                is_closed[i] = true;
+        }
+        // Everything received in this wake up is answered as one batch
+        ProcessBatch();
+        const auto now = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < polled; i++) {
+            if (!is_closed[i] && !clients_[i].output.empty() && !Flush(i))
+                is_closed[i] = true;
+            if (!is_closed[i] && !clients_[i].output.empty() && now - clients_[i].last_progress > stall_timeout_) {
+                std::cout << "Dropped a client which stopped reading its replies" << std::endl;
+                dropped_count_++;
+                is_closed[i] = true;
+            }
+        }
+        for (std::size_t i = polled; i-- > 0;) {
+            if (is_closed[i]) {
+                close(clients_[i].fd);
+                clients_.erase(clients_.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+        if ((fds[0].revents & POLLIN) != 0)
+            Accept();
+    }
+}
+
+void PlannerServer::Accept() {
+    while (true) {
+        const int fd = accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0)
+            return;
+        if (!SetNonBlocking(fd)) {
+            close(fd);
+            continue;
+        }
+        Client client;
+        client.fd = fd;
+        clients_.push_back(std::move(client));
+    }
+}
+
+bool PlannerServer::Receive(const std::size_t &client) {
+    Client &peer = clients_[client];
+    // A hang up is found by Flush while the client is not read
+    if (peer.output.size() >= max_output_bytes_)
+        return true;
+    char buffer[4096];
+    // The rest stays in the socket, so the input holds at most kMaxInputBytes
+    for (std::size_t budget = kMaxInputBytes; budget > 0;) {
+        const ssize_t received = recv(peer.fd, buffer, std::min(sizeof(buffer), budget), 0);
+        if (received > 0) {
+            peer.input.insert(peer.input.end(), buffer, buffer + received);
+            budget -= static_cast<std::size_t>(received);
+            continue;
+        }
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        if (received < 0 && errno == EINTR)
+            continue;
+        return false;
+    }
+    std::size_t offset = 0;
+    for (; offset + sizeof(PlanRequest) <= peer.input.size(); offset += sizeof(PlanRequest)) {
+        Pending pending;
+        pending.client = client;
+        std::memcpy(&pending.request, peer.input.data() + offset, sizeof(PlanRequest));
+        pending_.push_back(pending);
+    }
+    peer.input.erase(peer.input.begin(), peer.input.begin() + static_cast<std::ptrdiff_t>(offset));
+    return true;
+}
+
+void PlannerServer::set_metrics(PlannerMetrics *metrics) {
+    single_metrics_ = metrics == nullptr ? nullptr : &metrics->Get("wavefront", "single_goal", "any");
+    shared_metrics_ = metrics == nullptr ? nullptr : &metrics->Get("wavefront", "shared_goal", "any");
+}
+
+void PlannerServer::set_client_limits(const std::size_t &max_output_bytes,
+                                      const std::chrono::milliseconds &stall_timeout) {
+    max_output_bytes_ = max_output_bytes;
+    stall_timeout_ = stall_timeout;
+}
+
+void PlannerServer::ProcessBatch() {
+    if (pending_.empty())
+        return;
+    const auto batch_begin = std::chrono::steady_clock::now();
+    batch_count_++;
+    // The whole batch is planned on the version current when it starts
+    std::unique_ptr<SnapshotStore::Reader> reader;
+    if (store_ != nullptr) {
+        reader.reset(new SnapshotStore::Reader(*store_));
+        if ((*reader)->get_version() != version_) {
+            version_ = (*reader)->get_version();
+            wavefront_.reset(new Wavefront((*reader)->get_grid()));
+            cache_.clear();
+        }
+    }
+    for (auto &pending : pending_) {
+        const std::pair<int, int> goal{pending.request.goal_x, pending.request.goal_y};
+        pending.goal = wavefront_->IsFree(goal) ? wavefront_->ToIndex(goal) : -1;
+    }
+    std::stable_sort(pending_.begin(), pending_.end(), [](const Pending &a, const Pending &b) {
+        return a.goal < b.goal;
+    });
+    for (std::size_t begin = 0, end = 0; begin < pending_.size(); begin = end) {
+        end = begin;
+        while (end < pending_.size() && pending_[end].goal == pending_[begin].goal)
+            end++;
+        const int goal = pending_[begin].goal;
+        const bool is_cached = std::any_of(cache_.begin(), cache_.end(), [&goal](const CachedGoal &entry) {
+            return entry.goal == goal;
+        });
+        for (std::size_t i = begin; i < end; i++) {
+            const std::pair<int, int> start{pending_[i].request.start_x, pending_[i].request.start_y};
+            path_.clear();
+            QueryMetrics *metrics = shared_metrics_;
+            std::uint64_t expanded = 0;
+            if (goal < 0) {
+                // Unreachable goal, nothing to search
+            } else if (end - begin == 1 && !is_cached) {
+                // A lone goal does not pay for a full distance map
+                search_count_++;
+                metrics = single_metrics_;
+                wavefront_->ShortestPath(start, wavefront_->ToNode(goal), path_);
+                expanded = wavefront_->get_reached();
+            } else {
+                // The request which builds the shared map is charged with its cells
+                const std::uint64_t searches = search_count_;
+                const std::vector<int> &distance = DistanceFrom(goal);
+                if (search_count_ != searches)
+                    expanded = wavefront_->get_reached();
+                wavefront_->Descend(distance, start, path_);
+            }
+            Reply(pending_[i], path_);
+            if (metrics != nullptr)
+                metrics->Record(std::chrono::steady_clock::now() - batch_begin, expanded,
+                                static_cast<int>(path_.size()) - 1);
+        }
+    }
+    request_count_ += pending_.size();
+    pending_.clear();
+}
+
+const std::vector<int> &PlannerServer::DistanceFrom(const int &goal) {
+    for (auto &entry : cache_) {
+        if (entry.goal == goal) {
+            entry.last_used = batch_count_;
+            return entry.distance;
+        }
+    }
+    search_count_++;
+    CachedGoal *slot;
+    if (cache_.size() < cached_goals_) {
+        cache_.emplace_back();
+        slot = &cache_.back();
+    } else {
+        slot = &*std::min_element(cache_.begin(), cache_.end(), [](const CachedGoal &a, const CachedGoal &b) {
+            return a.last_used < b.last_used;
+        });
+    }
+    slot->goal = goal;
+    slot->last_used = batch_count_;
+    wavefront_->DistanceMap(wavefront_->ToNode(goal), slot->distance);
+    return slot->distance;
+}
+
+void PlannerServer::Reply(const Pending &pending, const std::vector<std::pair<int, int>> &path) {
+    PlanReply reply;
+    reply.id = pending.request.id;
+    reply.mode = pending.request.mode;
+    reply.status = path.empty() ? -1 : static_cast<std::int32_t>(path.size()) - 1;
+    reply.version = version_;
+    Client &peer = clients_[pending.client];
+    std::vector<char> &output = peer.output;
+    if (output.empty())
+        peer.last_progress = std::chrono::steady_clock::now();
+    if (path.empty())
+        reply.count = 0;
+    else if (reply.mode == kReplyCommands)
+        reply.count = static_cast<std::uint32_t>(path.size() - 1);
+    else
+        reply.count = static_cast<std::uint32_t>(path.size());
+    const char *header = reinterpret_cast<const char *>(&reply);
+    output.insert(output.end(), header, header + sizeof(reply));
+    if (path.empty())
+        return;
+    if (reply.mode == kReplyCommands) {
+        for (std::size_t i = 1; i < path.size(); i++) {
+            const int dx = path[i].first - path[i - 1].first, dy = path[i].second - path[i - 1].second;
+            std::uint8_t command = kCommandUp;
+            if (dx == 1)
+                command = kCommandRight;
+            else if (dx == -1)
+                command = kCommandLeft;
+            else if (dy == -1)
+                command = kCommandDown;
+            output.push_back(static_cast<char>(command));
+        }
+    } else {
+        for (const auto &node : path) {
+            const std::int32_t xy[2] = {node.first, node.second};
+            const char *bytes = reinterpret_cast<const char *>(xy);
+            output.insert(output.end(), bytes, bytes + sizeof(xy));
+        }
+    }
+}
+
+bool PlannerServer::Flush(const std::size_t &client) {
+    Client &peer = clients_[client];
+    std::size_t sent_total = 0;
+    while (sent_total < peer.output.size()) {
+        const ssize_t sent = send(peer.fd, peer.output.data() + sent_total,
+                                  peer.output.size() - sent_total, MSG_NOSIGNAL);
+        if (sent > 0) {
+            sent_total += static_cast<std::size_t>(sent);
+            continue;
+        }
+        if (sent < 0 && errno == EINTR)
+            continue;
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+            break;
+        return false;
+    }
+    if (sent_total > 0)
+        peer.last_progress = std::chrono::steady_clock::now();
+    peer.output.erase(peer.output.begin(), peer.output.begin() + static_cast<std::ptrdiff_t>(sent_total));
+    return true;
+}
@@ -0,0 +1,215 @@
+/*
+ * @file        RealTimePlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file RealTimePlanner.cpp contains the definitions for LearnedHeuristic and
+ *              RealTimePlanner classes
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/MobileRobot.h"
+#include "../include/RealTimePlanner.h"
+
+const int RealTimePlanner::kNoPath;
+const int RealTimePlanner::kMoving;
+const int RealTimePlanner::kArrived;
+
+int LearnedHeuristic::Get(const int &goal, const int &cell) const {
+    const int manhattan = std::abs(goal % length_ - cell % length_) + std::abs(goal / length_ - cell / length_);
+    const auto entry = values_.find(KeyOf(goal, cell));
+    return entry == values_.end() ? manhattan : std::max(entry->second, manhattan);
+}
+
+void LearnedHeuristic::Raise(const int &goal, const int &cell, const int &value) {
+    if (value <= Get(goal, cell))
+        return;
+    values_[KeyOf(goal, cell)] = value;
+}
+
+bool LearnedHeuristic::Save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cout << "Save learned heuristic failed, cannot open " << path << std::endl;
+        return false;
+    }
+    LearnedHeuristicHeader header;
+    header.length = static_cast<std::uint32_t>(length_);
+    header.width = static_cast<std::uint32_t>(width_);
+    header.entry_count = static_cast<std::uint32_t>(values_.size());
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    std::vector<std::uint32_t> words;
+    words.reserve(values_.size() * 3);
+    for (const auto &entry : values_) {
+        words.push_back(static_cast<std::uint32_t>(entry.first >> 32));
+        words.push_back(static_cast<std::uint32_t>(entry.first));
+        words.push_back(static_cast<std::uint32_t>(entry.second));
+    }
+    file.write(reinterpret_cast<const char *>(words.data()),
+               static_cast<std::streamsize>(words.size() * sizeof(std::uint32_t)));
+    if (!file) {
+        std::cout << "Save learned heuristic failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool LearnedHeuristic::Load(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Load learned heuristic failed, cannot open " << path << std::endl;
+        return false;
+    }
+    LearnedHeuristicHeader header;
+    file.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!file || std::string(header.magic, 4) != "MZLH" || header.version != 1) {
+        std::cout << "Load learned heuristic failed, " << path << " is not a learned heuristic" << std::endl;
+        return false;
+    }
+    if (static_cast<int>(header.length) != length_ || static_cast<int>(header.width) != width_) {
+        std::cout << "Load learned heuristic failed, " << path << " was built for another map" << std::endl;
+        return false;
+    }
+    // The entry count sizes nothing before it matches the size of the file
+    file.seekg(0, std::ios::end);
+    const auto file_bytes = static_cast<std::uint64_t>(file.tellg());
+    file.seekg(sizeof(header));
+    if (file_bytes != sizeof(header) + 3 * sizeof(std::uint32_t) * static_cast<std::uint64_t>(header.entry_count)) {
+        std::cout << "Load learned heuristic failed, " << path << " does not match its header" << std::endl;
+        return false;
+    }
+    std::vector<std::uint32_t> words(header.entry_count * std::size_t{3});
+    file.read(reinterpret_cast<char *>(words.data()),
+              static_cast<std::streamsize>(words.size() * sizeof(std::uint32_t)));
+    const std::uint32_t cells = header.length * header.width;
+    bool is_valid = static_cast<bool>(file);
+    for (std::size_t i = 0; is_valid && i < words.size(); i += 3)
+        is_valid = words[i] < cells && words[i + 1] < cells;
+    if (!is_valid) {
+        std::cout << "Load learned heuristic failed, " << path << " is truncated" << std::endl;
+        return false;
+    }
+    values_.clear();
+    values_.reserve(header.entry_count);
+    for (std::size_t i = 0; i < words.size(); i += 3)
+        Raise(static_cast<int>(words[i]), static_cast<int>(words[i + 1]), static_cast<int>(words[i + 2]));
+    return true;
+}
+
+RealTimePlanner::RealTimePlanner(const BitGrid &grid, LearnedHeuristic &heuristic, const int &lookahead)
+        : grid_{grid}, heuristic_{heuristic}, lookahead_{std::max(lookahead, 1)} {}
+
+int RealTimePlanner::Start(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    moves_ = 0;
+    expansions_ = 0;
+    position_ = -1;
+    goal_ = -1;
+    if (!grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal)) {
+        status_ = kNoPath;
+        return status_;
+    }
+    position_ = grid_.ToIndex(start);
+    goal_ = grid_.ToIndex(goal);
+    status_ = position_ == goal_ ? kArrived : kMoving;
+    return status_;
+}
+
+int RealTimePlanner::Step(MobileRobot &robot) {
+    if (status_ != kMoving)
+        return status_;
+    // A* limited to the lookahead, from the robot
+    workspace_.Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    workspace_.Update(position_, 0, position_);
+    workspace_.Push(heuristic_.Get(goal_, position_), position_);
+    closed_.clear();
+    int best = -1;
+    while (!workspace_.IsEmpty()) {
+        const HeapEntry entry = workspace_.Top();
+        if (workspace_.IsClosed(entry.state)) {
+            workspace_.Pop();
+            continue;
+        }
+        // The goal or the frontier cell with the lowest f ends the search
+        if (entry.state == goal_ || static_cast<int>(closed_.size()) >= lookahead_) {
+            best = entry.state;
+            break;
+        }
+        workspace_.Pop();
+        workspace_.Close(entry.state);
+        closed_.push_back(entry.state);
+        const std::pair<int, int> node = grid_.ToNode(entry.state);
+        const double cost = workspace_.get_cost(entry.state) + 1;
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int next_cell = grid_.ToIndex(next);
+            if (cost < workspace_.get_cost(next_cell)) {
+                workspace_.Update(next_cell, cost, entry.state);
+                workspace_.Push(cost + heuristic_.Get(goal_, next_cell), next_cell);
+            }
+        }
+    }
+    expansions_ = static_cast<int>(closed_.size());
+    if (best < 0) {
+        // Every cell reachable from the robot was expanded without meeting the goal
+        status_ = kNoPath;
+        return status_;
+    }
+    // RTAA* learning: h(s) = f(best) - g(s) for every expanded cell
+    const int best_cost = static_cast<int>(workspace_.get_cost(best));
+    const int best_f = best_cost + heuristic_.Get(goal_, best);
+    for (const int cell : closed_)
+        heuristic_.Raise(goal_, cell, best_f - static_cast<int>(workspace_.get_cost(cell)));
+    if (heuristic_.Get(goal_, position_) > grid_.get_cell_count()) {
+        status_ = kNoPath;
+        return status_;
+    }
+    // First move of the path to the best cell
+    int next = best;
+    while (workspace_.get_parent(next) != position_)
+        next = workspace_.get_parent(next);
+    const int delta = next - position_;
+    if (delta == grid_.get_length())
+        robot.Execute("UP");
+    else if (delta == -grid_.get_length())
+        robot.Execute("DOWN");
+    else if (delta == 1)
+        robot.Execute("RIGHT");
+    else
+        robot.Execute("LEFT");
+    position_ = next;
+    moves_++;
+    if (position_ == goal_)
+        status_ = kArrived;
+    return status_;
+}
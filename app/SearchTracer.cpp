@@ -0,0 +1,231 @@
+/*
+ * @file        SearchTracer.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file SearchTracer.cpp contains the definitions for SearchTracer class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/SearchTracer.h"
+
+/*! \brief Magic and version at the start of a binary trace file */
+static const char kTraceMagic[4] = {'M', 'Z', 'T', 'R'};
+static const std::uint32_t kTraceVersion = 1;
+
+/*! \brief Names of the phases in the Chrome trace, indexed by phase */
+static const char *const kPhaseNames[2] = {"search", "reconstruct"};
+
+/*!
+ * \brief Formats a time in nanoseconds as microseconds with three decimals, exactly
+ * \param time - nanoseconds since the tracer started
+ * \return e.g. "1234567.089"
+ * */
+static std::string ToMicroseconds(const std::uint64_t &time) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%llu.%03u", static_cast<unsigned long long>(time / 1000),
+                  static_cast<unsigned>(time % 1000));
+    return text;
+}
+
+const std::uint8_t SearchTracer::kExpand;
+const std::uint8_t SearchTracer::kGenerate;
+const std::uint8_t SearchTracer::kPhaseBegin;
+const std::uint8_t SearchTracer::kPhaseEnd;
+const std::uint8_t SearchTracer::kPhaseSearch;
+const std::uint8_t SearchTracer::kPhaseReconstruct;
+
+SearchTracer::SearchTracer(const std::size_t &capacity) : origin_{std::chrono::steady_clock::now()} {
+    std::size_t size = 1;
+    while (size < capacity)
+        size <<= 1;
+    records_.resize(size);
+    mask_ = size - 1;
+}
+
+void SearchTracer::Snapshot(std::vector<TraceRecord> &records) const {
+    const std::uint64_t count = std::min<std::uint64_t>(head_, records_.size());
+    records.clear();
+    records.reserve(count);
+    for (std::uint64_t i = head_ - count; i < head_; i++)
+        records.push_back(records_[i & mask_]);
+}
+
+bool SearchTracer::Save(const std::string &path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cout << "Save trace failed, cannot open " << path << std::endl;
+        return false;
+    }
+    std::vector<TraceRecord> records;
+    Snapshot(records);
+    const auto count = static_cast<std::uint64_t>(records.size());
+    file.write(kTraceMagic, sizeof(kTraceMagic));
+    file.write(reinterpret_cast<const char *>(&kTraceVersion), sizeof(kTraceVersion));
+    file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char *>(records.data()),
+               static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+    if (!file) {
+        std::cout << "Save trace failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SearchTracer::Load(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cout << "Load trace failed, cannot open " << path << std::endl;
+        return false;
+    }
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint64_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    file.read(reinterpret_cast<char *>(&count), sizeof(count));
+    if (!file || std::memcmp(magic, kTraceMagic, sizeof(magic)) != 0 || version != kTraceVersion) {
+        std::cout << "Load trace failed, " << path << " is not a trace" << std::endl;
+        return false;
+    }
+    std::vector<TraceRecord> records(count);
+    file.read(reinterpret_cast<char *>(records.data()),
+              static_cast<std::streamsize>(records.size() * sizeof(TraceRecord)));
+    if (!file) {
+        std::cout << "Load trace failed, " << path << " is truncated" << std::endl;
+        return false;
+    }
+    std::size_t size = 1;
+    while (size < records.size())
+        size <<= 1;
+    records.resize(std::max(size, records_.size()));
+    records_.swap(records);
+    mask_ = records_.size() - 1;
+    head_ = count;
+    return true;
+}
+
+bool SearchTracer::ExportChromeTrace(const std::string &path, const int &length) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cout << "Export trace failed, cannot open " << path << std::endl;
+        return false;
+    }
+    std::vector<TraceRecord> records;
+    Snapshot(records);
+    file << "{\"traceEvents\":[\n";
+    bool is_first = true;
+    for (const auto &record : records) {
+        // Written exactly: the default precision would merge events more than 1 s in
+        const std::string time = ToMicroseconds(record.time);
+        const char *name = kPhaseNames[std::min<int>(record.phase, 1)];
+        file << (is_first ? "" : ",\n");
+        is_first = false;
+        if (record.kind == kPhaseBegin || record.kind == kPhaseEnd) {
+            file << "{\"name\":\"" << name << "\",\"ph\":\"" << (record.kind == kPhaseBegin ? 'B' : 'E')
+                 << "\",\"ts\":" << time << ",\"pid\":1,\"tid\":1}";
+            continue;
+        }
+        file << "{\"name\":\"" << (record.kind == kExpand ? "expand" : "generate")
+             << "\",\"cat\":\"" << name << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":" << time
+             << ",\"pid\":1,\"tid\":1,\"args\":{\"x\":" << record.cell % length
+             << ",\"y\":" << record.cell / length << ",\"g\":" << record.cost_g
+             << ",\"h\":" << record.cost_h << ",\"open\":" << record.open_size << "}},\n"
+             << "{\"name\":\"open list\",\"ph\":\"C\",\"ts\":" << time
+             << ",\"pid\":1,\"args\":{\"size\":" << record.open_size << "}}";
+    }
+    file << "\n]}\n";
+    if (!file) {
+        std::cout << "Export trace failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SearchTracer::ExportFrames(const std::string &path, const BitGrid &grid,
+                                const int &expansions_per_frame) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file) {
+        std::cout << "Export frames failed, cannot open " << path << std::endl;
+        return false;
+    }
+    std::vector<TraceRecord> records;
+    Snapshot(records);
+    // 0 untouched, 1 open, 2 expanded
+    std::vector<std::uint8_t> state(static_cast<std::size_t>(grid.get_cell_count()), 0);
+    int frame = 0, expansions = 0, pending = 0;
+    std::uint32_t open_size = 0;
+    const auto write_frame = [&]() {
+        file << "frame " << frame++ << ", expansions " << expansions << ", open " << open_size << "\n";
+        for (int y = grid.get_width() - 1; y >= 0; y--) {
+            for (int x = 0; x < grid.get_length(); x++) {
+                const std::uint8_t cell = state[static_cast<std::size_t>(y) * grid.get_length() + x];
+                if (!grid.IsNotObstacle(std::make_pair(x, y)))
+                    file << '#';
+                else
+                    file << (cell == 2 ? '.' : cell == 1 ? 'o' : ' ');
+            }
+            file << "\n";
+        }
+        file << "\n";
+        pending = 0;
+    };
+    for (const auto &record : records) {
+        if (record.kind == kPhaseBegin && record.phase == kPhaseSearch) {
+            // A new search starts from an empty map
+            if (pending > 0)
+                write_frame();
+            std::fill(state.begin(), state.end(), 0);
+            expansions = 0;
+            continue;
+        }
+        if ((record.kind != kExpand && record.kind != kGenerate) || record.cell < 0 ||
+            record.cell >= grid.get_cell_count())
+            continue;
+        open_size = record.open_size;
+        if (record.kind == kGenerate) {
+            state[record.cell] = std::max<std::uint8_t>(state[record.cell], 1);
+            continue;
+        }
+        state[record.cell] = 2;
+        expansions++;
+        if (++pending >= std::max(expansions_per_frame, 1))
+            write_frame();
+    }
+    if (pending > 0)
+        write_frame();
+    if (!file) {
+        std::cout << "Export frames failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
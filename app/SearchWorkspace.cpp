@@ -0,0 +1,88 @@
+/*
+ * @file        SearchWorkspace.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file SearchWorkspace.cpp contains the definitions for SearchWorkspace
+ *              class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "../include/SearchWorkspace.h"
+
+SearchWorkspace &SearchWorkspace::Local() {
+    thread_local SearchWorkspace workspace;
+    return workspace;
+}
+
+void SearchWorkspace::Reset(const std::size_t &states) {
+    if (states > seen_.size()) {
+        seen_.resize(states, 0);
+        closed_.resize(states, 0);
+        cost_.resize(states, 0);
+        parent_.resize(states, -1);
+    }
+    epoch_++;
+    closed_epoch_++;
+    // After a wrap around, old stamps could look valid again
+    if (epoch_ == 0) {
+        std::fill(seen_.begin(), seen_.end(), 0);
+        epoch_ = 1;
+    }
+    if (closed_epoch_ == 0) {
+        std::fill(closed_.begin(), closed_.end(), 0);
+        closed_epoch_ = 1;
+    }
+    heap_.clear();
+    sequence_ = 0;
+}
+
+void SearchWorkspace::ReopenAll() {
+    closed_epoch_++;
+    if (closed_epoch_ == 0) {
+        std::fill(closed_.begin(), closed_.end(), 0);
+        closed_epoch_ = 1;
+    }
+}
+
+void SearchWorkspace::Push(const double &priority, const int &state) {
+    HeapEntry entry;
+    entry.priority = priority;
+    entry.sequence = sequence_++;
+    entry.state = state;
+    heap_.push_back(entry);
+    std::push_heap(heap_.begin(), heap_.end(), [](const HeapEntry &a, const HeapEntry &b) {
+        return IsBefore(b, a);
+    });
+}
+
+HeapEntry SearchWorkspace::Pop() {
+    std::pop_heap(heap_.begin(), heap_.end(), [](const HeapEntry &a, const HeapEntry &b) {
+        return IsBefore(b, a);
+    });
+    const HeapEntry entry = heap_.back();
+    heap_.pop_back();
+    return entry;
+}
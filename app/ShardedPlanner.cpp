@@ -0,0 +1,603 @@
+/*
+ * @file        ShardedPlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file ShardedPlanner.cpp contains the definitions for ShardedPlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Path.h"
+#include "../include/ShardedPlanner.h"
+#include "../include/TiledMap.h"
+
+const int ShardedPlanner::kDefaultShardSize;
+
+namespace {
+
+/*! \brief Commands of the mailbox */
+const std::int32_t kQuit = 0;
+const std::int32_t kAttach = 1;
+const std::int32_t kRefine = 2;
+
+/*! \brief Planners started by this process, to name their segments */
+int started_count = 0;
+
+/*! \brief Boundary cells of a table */
+const std::uint32_t *CellsOf(const ShardTableHeader *table) {
+    return reinterpret_cast<const std::uint32_t *>(table + 1);
+}
+
+/*! \brief Distances between the boundary nodes of a table */
+const std::int32_t *DistancesOf(const ShardTableHeader *table) {
+    return reinterpret_cast<const std::int32_t *>(CellsOf(table) + table->boundary_count);
+}
+
+/*!
+ * \struct WorkerShard
+ * \brief Define a shard held by a worker: its first cell, its free space, and its
+ * boundary nodes as indices of the shard grid
+ * */
+struct WorkerShard {
+    int x0 = 0;
+    int y0 = 0;
+    BitGrid grid;
+    std::vector<int> boundary;
+};
+
+/*!
+ * \brief Runs a BFS inside a shard
+ * \param grid - free space of the shard
+ * \param from - index of the first cell
+ * \param target - index at which the search stops, -1 to reach every cell
+ * \param distance - output, moves to every cell, -1 if not reached
+ * \param parent - output, previous cell of every reached cell
+ * \param queue - scratch
+ * */
+void Flood(const BitGrid &grid, const int &from, const int &target, std::vector<int> &distance,
+           std::vector<int> &parent, std::vector<int> &queue) {
+    const int length = grid.get_length();
+    distance.assign(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    parent.resize(distance.size());
+    queue.clear();
+    distance[from] = 0;
+    parent[from] = from;
+    queue.push_back(from);
+    for (std::size_t head = 0; head < queue.size(); head++) {
+        const int cell = queue[head];
+        if (cell == target)
+            return;
+        const int x = cell % length, y = cell / length;
+        const int next[4][2] = {{x, y + 1}, {x, y - 1}, {x + 1, y}, {x - 1, y}};
+        for (const auto &n : next) {
+            const std::pair<int, int> node(n[0], n[1]);
+            if (!grid.IsWithinRegion(node) || !grid.IsNotObstacle(node))
+                continue;
+            const int index = n[1] * length + n[0];
+            if (distance[index] >= 0)
+                continue;
+            distance[index] = distance[cell] + 1;
+            parent[index] = cell;
+            queue.push_back(index);
+        }
+    }
+}
+
+}  // namespace
+
+ShardedPlanner::~ShardedPlanner() {
+    Stop();
+}
+
+bool ShardedPlanner::Start(const std::string &path, const int &workers, const int &shard_size,
+                           const bool &is_pinned) {
+    Stop();
+    if (shard_size < 2) {
+        std::cout << "Start sharded planner failed, a shard must be at least 2 cells wide" << std::endl;
+        return false;
+    }
+    if (!map_.Open(path))
+        return false;
+    length_ = map_.get_length();
+    width_ = map_.get_width();
+    shard_size_ = shard_size;
+    shards_x_ = (length_ + shard_size - 1) / shard_size;
+    shards_y_ = (width_ + shard_size - 1) / shard_size;
+    const int shard_count = get_shard_count();
+    int worker_count = workers > 0 ? workers : static_cast<int>(std::thread::hardware_concurrency());
+    worker_count = std::max(1, std::min(worker_count, shard_count));
+
+    // Workers own runs of neighbouring shards in row-major order
+    owners_.resize(static_cast<std::size_t>(shard_count));
+    for (int s = 0; s < shard_count; s++)
+        owners_[s] = static_cast<int>(static_cast<long long>(s) * worker_count / shard_count);
+
+    // The control segment is unlinked as soon as it is mapped: the workers inherit the
+    // mapping, and nothing is left behind if a process dies
+    name_ = "/maze_shards_" + std::to_string(getpid()) + "_" + std::to_string(++started_count);
+    buffer_cells_ = static_cast<std::size_t>(std::max(shard_size * shard_size, 4 * shard_size));
+    control_bytes_ = worker_count * (sizeof(Mailbox) + buffer_cells_ * sizeof(std::int32_t));
+    const int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        std::cout << "Start sharded planner failed, cannot create " << name_ << std::endl;
+        Stop();
+        return false;
+    }
+    void *mapping = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(control_bytes_)) == 0)
+        mapping = mmap(nullptr, control_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    shm_unlink(name_.c_str());
+    if (mapping == MAP_FAILED) {
+        std::cout << "Start sharded planner failed, cannot map " << name_ << std::endl;
+        Stop();
+        return false;
+    }
+    control_ = mapping;
+    mailboxes_ = static_cast<Mailbox *>(control_);
+    buffers_ = reinterpret_cast<std::int32_t *>(mailboxes_ + worker_count);
+
+    // Pinned workers are spread evenly over the CPUs allowed to the coordinator, which
+    // spreads them over the NUMA nodes
+    std::vector<int> cpus;
+    if (is_pinned) {
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET(cpu, &allowed))
+                    cpus.push_back(cpu);
+            }
+        }
+    }
+    for (int w = 0; w < worker_count; w++) {
+        sem_init(&mailboxes_[w].request, 1, 0);
+        sem_init(&mailboxes_[w].reply, 1, 0);
+    }
+    std::cout.flush();
+    for (int w = 0; w < worker_count; w++) {
+        const pid_t pid = fork();
+        if (pid == 0)
+            RunWorker(w, cpus.empty() ? -1 : cpus[static_cast<std::size_t>(w) * cpus.size() / worker_count]);
+        if (pid < 0) {
+            std::cout << "Start sharded planner failed, cannot start worker " << w << std::endl;
+            Stop();
+            return false;
+        }
+        pids_.push_back(pid);
+    }
+    for (int w = 0; w < worker_count; w++) {
+        if (!Wait(w) || mailboxes_[w].result != 0) {
+            std::cout << "Start sharded planner failed, worker " << w << " could not build its tables" << std::endl;
+            Stop();
+            return false;
+        }
+    }
+
+    // Maps the tables, numbering the boundary nodes shard by shard
+    tables_.assign(static_cast<std::size_t>(shard_count), nullptr);
+    table_bytes_.assign(static_cast<std::size_t>(shard_count), 0);
+    first_node_.assign(static_cast<std::size_t>(shard_count) + 1, 0);
+    for (int s = 0; s < shard_count; s++) {
+        const std::string table_name = name_ + "." + std::to_string(s);
+        const int table_fd = shm_open(table_name.c_str(), O_RDONLY, 0);
+        struct stat info{};
+        void *table = MAP_FAILED;
+        if (table_fd >= 0 && fstat(table_fd, &info) == 0 &&
+            static_cast<std::size_t>(info.st_size) >= sizeof(ShardTableHeader))
+            table = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, table_fd, 0);
+        if (table_fd >= 0)
+            close(table_fd);
+        shm_unlink(table_name.c_str());
+        if (table == MAP_FAILED) {
+            std::cout << "Start sharded planner failed, cannot map " << table_name << std::endl;
+            Stop();
+            return false;
+        }
+        tables_[s] = static_cast<const ShardTableHeader *>(table);
+        table_bytes_[s] = static_cast<std::size_t>(info.st_size);
+        const ShardTableHeader &header = *tables_[s];
+        const std::size_t count = header.boundary_count;
+        if (!std::equal(header.magic, header.magic + 4, ShardTableHeader().magic) || header.shard != static_cast<std::uint32_t>(s) ||
+            table_bytes_[s] != sizeof(ShardTableHeader) + count * sizeof(std::uint32_t) + count * count * sizeof(std::int32_t)) {
+            std::cout << "Start sharded planner failed, " << table_name << " is not a shard table" << std::endl;
+            Stop();
+            return false;
+        }
+        first_node_[s + 1] = first_node_[s] + static_cast<int>(count);
+        cells_.insert(cells_.end(), CellsOf(tables_[s]), CellsOf(tables_[s]) + count);
+    }
+
+    // Moves across shards join boundary nodes, since both of their cells are free
+    first_cross_.assign(cells_.size() + 1, 0);
+    for (std::size_t n = 0; n < cells_.size(); n++) {
+        const int cell = static_cast<int>(cells_[n]);
+        const int x = cell % length_, y = cell / length_;
+        const int next[4][2] = {{x, y + 1}, {x, y - 1}, {x + 1, y}, {x - 1, y}};
+        for (const auto &m : next) {
+            if (m[0] < 0 || m[0] >= length_ || m[1] < 0 || m[1] >= width_)
+                continue;
+            const int other = m[1] * length_ + m[0];
+            if (ShardOf(other) == ShardOf(cell))
+                continue;
+            const int node = NodeOf(other);
+            if (node >= 0)
+                cross_.push_back(node);
+        }
+        first_cross_[n + 1] = static_cast<std::uint32_t>(cross_.size());
+    }
+    distance_.assign(cells_.size(), 0);
+    parent_.assign(cells_.size(), -1);
+    stamp_.assign(cells_.size(), 0);
+    epoch_ = 0;
+    return true;
+}
+
+void ShardedPlanner::Stop() {
+    for (std::size_t w = 0; w < pids_.size(); w++) {
+        if (pids_[w] <= 0)
+            continue;
+        Post(static_cast<int>(w), kQuit, -1, -1, -1);
+        waitpid(pids_[w], nullptr, 0);
+    }
+    if (control_ != nullptr) {
+        for (std::size_t w = 0; w < pids_.size(); w++) {
+            sem_destroy(&mailboxes_[w].request);
+            sem_destroy(&mailboxes_[w].reply);
+        }
+        munmap(control_, control_bytes_);
+    }
+    for (std::size_t s = 0; s < tables_.size(); s++) {
+        if (tables_[s] != nullptr)
+            munmap(const_cast<ShardTableHeader *>(tables_[s]), table_bytes_[s]);
+    }
+    // Tables are unlinked once mapped, only those of a failed start are left
+    if (!name_.empty()) {
+        for (int s = 0; s < get_shard_count(); s++)
+            shm_unlink((name_ + "." + std::to_string(s)).c_str());
+    }
+    control_ = nullptr;
+    mailboxes_ = nullptr;
+    buffers_ = nullptr;
+    control_bytes_ = 0;
+    buffer_cells_ = 0;
+    name_.clear();
+    pids_.clear();
+    owners_.clear();
+    tables_.clear();
+    table_bytes_.clear();
+    first_node_.clear();
+    cells_.clear();
+    first_cross_.clear();
+    cross_.clear();
+    shards_x_ = shards_y_ = 0;
+    map_.Close();
+}
+
+int ShardedPlanner::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path) {
+    path.Clear();
+    if (control_ == nullptr || !map_.IsWithinRegion(start) || !map_.IsWithinRegion(goal) ||
+        !map_.IsNotObstacle(start) || !map_.IsNotObstacle(goal))
+        return -1;
+    const int start_cell = start.second * length_ + start.first;
+    const int goal_cell = goal.second * length_ + goal.first;
+    const int start_shard = ShardOf(start_cell), goal_shard = ShardOf(goal_cell);
+    const int start_owner = owners_[start_shard], goal_owner = owners_[goal_shard];
+
+    // Distances from the start and to the goal inside their shards, asked at once when
+    // two workers own the shards
+    Post(start_owner, kAttach, start_shard, start_cell, start_shard == goal_shard ? goal_cell : -1);
+    if (goal_owner != start_owner)
+        Post(goal_owner, kAttach, goal_shard, goal_cell, -1);
+    if (!Wait(start_owner)) {
+        std::cout << "Find path failed, worker " << start_owner << " has stopped" << std::endl;
+        return -1;
+    }
+    const int direct = mailboxes_[start_owner].result;
+    from_start_.assign(BufferOf(start_owner), BufferOf(start_owner) + tables_[start_shard]->boundary_count);
+    if (goal_owner == start_owner)
+        Post(goal_owner, kAttach, goal_shard, goal_cell, -1);
+    if (!Wait(goal_owner)) {
+        std::cout << "Find path failed, worker " << goal_owner << " has stopped" << std::endl;
+        return -1;
+    }
+    to_goal_.assign(BufferOf(goal_owner), BufferOf(goal_owner) + tables_[goal_shard]->boundary_count);
+
+    // Dijkstra over the boundary nodes, stopped when no node can beat the best path
+    if (++epoch_ == 0) {
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        epoch_ = 1;
+    }
+    queue_.clear();
+    const auto relax = [this](const int &node, const int &distance, const int &parent) {
+        if (stamp_[node] == epoch_ && distance_[node] <= distance)
+            return;
+        stamp_[node] = epoch_;
+        distance_[node] = distance;
+        parent_[node] = parent;
+        queue_.emplace_back(distance, node);
+        std::push_heap(queue_.begin(), queue_.end(), std::greater<std::pair<int, int>>());
+    };
+    for (std::size_t i = 0; i < from_start_.size(); i++) {
+        if (from_start_[i] >= 0)
+            relax(first_node_[start_shard] + static_cast<int>(i), from_start_[i], -1);
+    }
+    int best = direct >= 0 ? direct : INT_MAX, meeting = -1;
+    while (!queue_.empty()) {
+        const std::pair<int, int> top = queue_.front();
+        std::pop_heap(queue_.begin(), queue_.end(), std::greater<std::pair<int, int>>());
+        queue_.pop_back();
+        if (top.first >= best)
+            break;
+        const int node = top.second;
+        if (top.first > distance_[node])
+            continue;
+        const int shard = ShardOf(static_cast<int>(cells_[node]));
+        const int first = first_node_[shard];
+        if (shard == goal_shard && to_goal_[node - first] >= 0 && top.first + to_goal_[node - first] < best) {
+            best = top.first + to_goal_[node - first];
+            meeting = node;
+        }
+        const int count = first_node_[shard + 1] - first;
+        const std::int32_t *row = DistancesOf(tables_[shard]) + static_cast<std::size_t>(node - first) * count;
+        for (int j = 0; j < count; j++) {
+            if (row[j] > 0)
+                relax(first + j, top.first + row[j], node);
+        }
+        for (std::uint32_t a = first_cross_[node]; a < first_cross_[node + 1]; a++)
+            relax(cross_[a], top.first + 1, node);
+    }
+    if (best == INT_MAX)
+        return -1;
+
+    // Parts of the path: inside a shard between boundary nodes, or a move across shards
+    parts_.clear();
+    if (meeting < 0) {
+        parts_.push_back(Part{start_shard, start_cell, goal_cell, {}});
+    } else {
+        std::vector<int> chain;
+        for (int node = meeting; node >= 0; node = parent_[node])
+            chain.push_back(node);
+        int previous = start_cell;
+        for (auto node = chain.rbegin(); node != chain.rend(); ++node) {
+            const int cell = static_cast<int>(cells_[*node]);
+            if (ShardOf(cell) == ShardOf(previous))
+                parts_.push_back(Part{ShardOf(cell), previous, cell, {}});
+            else
+                parts_.push_back(Part{-1, previous, cell, {previous, cell}});
+            previous = cell;
+        }
+        parts_.push_back(Part{goal_shard, previous, goal_cell, {}});
+    }
+
+    // Every worker fills its parts one after the other, all workers at once
+    const int worker_count = get_worker_count();
+    std::vector<std::vector<std::size_t>> queued(static_cast<std::size_t>(worker_count));
+    for (std::size_t i = 0; i < parts_.size(); i++) {
+        if (parts_[i].shard >= 0)
+            queued[owners_[parts_[i].shard]].push_back(i);
+    }
+    for (std::size_t round = 0;; round++) {
+        bool is_pending = false;
+        for (int w = 0; w < worker_count; w++) {
+            if (round < queued[w].size()) {
+                const Part &part = parts_[queued[w][round]];
+                Post(w, kRefine, part.shard, part.from, part.to);
+                is_pending = true;
+            }
+        }
+        if (!is_pending)
+            break;
+        for (int w = 0; w < worker_count; w++) {
+            if (round >= queued[w].size())
+                continue;
+            if (!Wait(w) || mailboxes_[w].result < 0) {
+                std::cout << "Find path failed, worker " << w << " could not join the path" << std::endl;
+                return -1;
+            }
+            parts_[queued[w][round]].cells.assign(BufferOf(w), BufferOf(w) + mailboxes_[w].result);
+        }
+    }
+    std::vector<std::pair<int, int>> nodes;
+    nodes.reserve(static_cast<std::size_t>(best) + 1);
+    nodes.emplace_back(start);
+    for (const Part &part : parts_) {
+        for (std::size_t i = 1; i < part.cells.size(); i++)
+            nodes.emplace_back(part.cells[i] % length_, part.cells[i] / length_);
+    }
+    path.Assign(nodes);
+    return best;
+}
+
+std::size_t ShardedPlanner::get_table_bytes() const {
+    std::size_t bytes = 0;
+    for (const std::size_t &size : table_bytes_)
+        bytes += size;
+    return bytes;
+}
+
+void ShardedPlanner::RunWorker(const int &worker, const int &cpu) {
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+    Mailbox &mailbox = mailboxes_[worker];
+    std::int32_t *buffer = BufferOf(worker);
+    const int first_shard = static_cast<int>(std::lower_bound(owners_.begin(), owners_.end(), worker) - owners_.begin());
+    const int last_shard = static_cast<int>(std::upper_bound(owners_.begin(), owners_.end(), worker) - owners_.begin());
+    std::vector<WorkerShard> shards(static_cast<std::size_t>(last_shard - first_shard));
+    std::vector<int> distance, parent, queue;
+
+    // Loads the shards from the inherited mapping of the map and writes their tables
+    bool is_ready = true;
+    for (int s = first_shard; s < last_shard && is_ready; s++) {
+        WorkerShard &shard = shards[s - first_shard];
+        shard.x0 = s % shards_x_ * shard_size_;
+        shard.y0 = s / shards_x_ * shard_size_;
+        const int length = std::min(shard_size_, length_ - shard.x0);
+        const int width = std::min(shard_size_, width_ - shard.y0);
+        shard.grid = BitGrid(length, width);
+        for (int y = 0; y < width; y++) {
+            for (int x = 0; x < length; x++) {
+                if (!map_.IsNotObstacle(std::make_pair(shard.x0 + x, shard.y0 + y)))
+                    continue;
+                shard.grid.SetFree(x, y, true);
+                const bool is_edge = x == 0 || y == 0 || x == length - 1 || y == width - 1;
+                if (!is_edge)
+                    continue;
+                const int next[4][2] = {{x, y + 1}, {x, y - 1}, {x + 1, y}, {x - 1, y}};
+                for (const auto &n : next) {
+                    const std::pair<int, int> node(shard.x0 + n[0], shard.y0 + n[1]);
+                    const bool is_outside = n[0] < 0 || n[0] >= length || n[1] < 0 || n[1] >= width;
+                    if (is_outside && map_.IsWithinRegion(node) && map_.IsNotObstacle(node)) {
+                        shard.boundary.push_back(y * length + x);
+                        break;
+                    }
+                }
+            }
+        }
+        const std::size_t count = shard.boundary.size();
+        const std::size_t bytes = sizeof(ShardTableHeader) + count * sizeof(std::uint32_t) + count * count * sizeof(std::int32_t);
+        const std::string table_name = name_ + "." + std::to_string(s);
+        const int fd = shm_open(table_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        void *mapping = MAP_FAILED;
+        if (fd >= 0) {
+            if (ftruncate(fd, static_cast<off_t>(bytes)) == 0)
+                mapping = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+        }
+        if (mapping == MAP_FAILED) {
+            std::cout << "Worker " << worker << " failed, cannot create " << table_name << std::endl;
+            is_ready = false;
+            break;
+        }
+        auto *header = new(mapping) ShardTableHeader();
+        header->shard = static_cast<std::uint32_t>(s);
+        header->boundary_count = static_cast<std::uint32_t>(count);
+        auto *cells = reinterpret_cast<std::uint32_t *>(header + 1);
+        auto *table = reinterpret_cast<std::int32_t *>(cells + count);
+        for (std::size_t i = 0; i < count; i++) {
+            const int local = shard.boundary[i];
+            cells[i] = static_cast<std::uint32_t>((shard.y0 + local / length) * length_ + shard.x0 + local % length);
+        }
+        for (std::size_t i = 0; i < count; i++) {
+            Flood(shard.grid, shard.boundary[i], -1, distance, parent, queue);
+            for (std::size_t j = 0; j < count; j++)
+                table[i * count + j] = distance[shard.boundary[j]];
+        }
+        munmap(mapping, bytes);
+    }
+    mailbox.result = is_ready ? 0 : -1;
+    sem_post(&mailbox.reply);
+    if (!is_ready)
+        _exit(1);
+
+    // Serves the coordinator until it says to quit
+    while (true) {
+        while (sem_wait(&mailbox.request) != 0) {}
+        if (mailbox.command == kQuit)
+            _exit(0);
+        const WorkerShard &shard = shards[mailbox.shard - first_shard];
+        const int length = shard.grid.get_length();
+        const auto local = [&](const int &cell) {
+            return (cell / length_ - shard.y0) * length + cell % length_ - shard.x0;
+        };
+        const auto global = [&](const int &cell) {
+            return (shard.y0 + cell / length) * length_ + shard.x0 + cell % length;
+        };
+        if (mailbox.command == kAttach) {
+            Flood(shard.grid, local(mailbox.from), -1, distance, parent, queue);
+            for (std::size_t j = 0; j < shard.boundary.size(); j++)
+                buffer[j] = distance[shard.boundary[j]];
+            mailbox.result = mailbox.to >= 0 ? distance[local(mailbox.to)] : -1;
+        } else {
+            const int target = local(mailbox.to);
+            Flood(shard.grid, local(mailbox.from), target, distance, parent, queue);
+            if (distance[target] < 0) {
+                mailbox.result = -1;
+            } else {
+                mailbox.result = distance[target] + 1;
+                for (int cell = target, i = distance[target]; i >= 0; cell = parent[cell], i--)
+                    buffer[i] = global(cell);
+            }
+        }
+        sem_post(&mailbox.reply);
+    }
+}
+
+void ShardedPlanner::Post(const int &worker, const int &command, const int &shard, const int &from, const int &to) {
+    Mailbox &mailbox = mailboxes_[worker];
+    mailbox.command = command;
+    mailbox.shard = shard;
+    mailbox.from = from;
+    mailbox.to = to;
+    sem_post(&mailbox.request);
+}
+
+bool ShardedPlanner::Wait(const int &worker) {
+    // Waits in slices, to notice a worker which has died instead of waiting forever
+    while (true) {
+        timespec deadline{};
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += 100000000;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
+        if (sem_timedwait(&mailboxes_[worker].reply, &deadline) == 0)
+            return true;
+        if (errno != ETIMEDOUT)
+            continue;
+        if (waitpid(pids_[worker], nullptr, WNOHANG) == pids_[worker]) {
+            pids_[worker] = -1;
+            return false;
+        }
+    }
+}
+
+int ShardedPlanner::NodeOf(const int &cell) const {
+    const int shard = ShardOf(cell);
+    const auto begin = cells_.begin() + first_node_[shard], end = cells_.begin() + first_node_[shard + 1];
+    const auto found = std::lower_bound(begin, end, static_cast<std::uint32_t>(cell));
+    return found != end && *found == static_cast<std::uint32_t>(cell) ? static_cast<int>(found - cells_.begin()) : -1;
+}
@@ -0,0 +1,182 @@
+/*
+ * @file        SnapshotStore.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file SnapshotStore.cpp contains the definitions for SnapshotStore class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/SnapshotStore.h"
+
+const int SnapshotStore::kDefaultReaders;
+
+SnapshotStore::Reader::Reader(const SnapshotStore &store) : store_{store}, slot_{store.Acquire()} {
+    // Publish the hazard, then check the version is still current: if it is, a writer
+    // retiring it afterwards will see the hazard and keep it
+    std::atomic<const MapSnapshot *> &hazard = store_.slots_[slot_].pointer;
+    snapshot_ = store_.current_.load();
+    while (true) {
+        hazard.store(snapshot_);
+        const MapSnapshot *current = store_.current_.load();
+        if (current == snapshot_)
+            break;
+        snapshot_ = current;
+    }
+}
+
+SnapshotStore::Reader::~Reader() {
+    store_.slots_[slot_].pointer.store(nullptr, std::memory_order_release);
+    store_.slots_[slot_].is_taken.store(false, std::memory_order_release);
+}
+
+SnapshotStore::SnapshotStore(const BitGrid &grid, const int &readers)
+        : current_{new MapSnapshot(grid, 1)}, slots_{new HazardSlot[std::max(readers, 1)]},
+          slot_count_{static_cast<std::size_t>(std::max(readers, 1))} {}
+
+void *SnapshotStore::HazardSlot::operator new[](std::size_t size) {
+    void *pointer = nullptr;
+    if (posix_memalign(&pointer, alignof(HazardSlot), size) != 0)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void SnapshotStore::HazardSlot::operator delete[](void *pointer) {
+    std::free(pointer);
+}
+
+SnapshotStore::~SnapshotStore() {
+    StopPeriodicPublish();
+    for (const auto *snapshot : retired_)
+        delete snapshot;
+    delete current_.load();
+}
+
+void SnapshotStore::Submit(const ObstacleUpdate &update) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    queued_.push_back(update);
+}
+
+void SnapshotStore::Submit(const std::vector<ObstacleUpdate> &updates) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    queued_.insert(queued_.end(), updates.begin(), updates.end());
+}
+
+std::uint64_t SnapshotStore::Publish() {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    std::vector<ObstacleUpdate> updates;
+    {
+        std::lock_guard<std::mutex> queue_lock(queue_mutex_);
+        updates.swap(queued_);
+    }
+    // Only this function replaces the current version, and it holds publish_mutex_
+    const MapSnapshot *previous = current_.load();
+    BitGrid grid = previous->get_grid();
+    bool is_changed = false;
+    for (const auto &update : updates) {
+        const std::pair<int, int> node{update.x, update.y};
+        if (grid.IsWithinRegion(node) && grid.IsNotObstacle(node) != update.is_free) {
+            grid.SetFree(update.x, update.y, update.is_free);
+            is_changed = true;
+        }
+    }
+    if (!is_changed) {
+        Reclaim();
+        return previous->get_version();
+    }
+    const MapSnapshot *next = new MapSnapshot(std::move(grid), previous->get_version() + 1);
+    current_.store(next);
+    retired_.push_back(previous);
+    Reclaim();
+    return next->get_version();
+}
+
+void SnapshotStore::StartPeriodicPublish(const std::chrono::milliseconds &interval) {
+    StopPeriodicPublish();
+    is_stopping_ = false;
+    publish_thread_ = std::thread([this, interval]() {
+        std::unique_lock<std::mutex> lock(wake_mutex_);
+        while (!wake_.wait_for(lock, interval, [this]() { return is_stopping_; }))
+            Publish();
+        Publish();
+    });
+}
+
+void SnapshotStore::StopPeriodicPublish() {
+    if (!publish_thread_.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        is_stopping_ = true;
+    }
+    wake_.notify_all();
+    publish_thread_.join();
+}
+
+std::size_t SnapshotStore::get_retired_count() const {
+    std::lock_guard<std::mutex> lock(publish_mutex_);
+    return retired_.size();
+}
+
+std::size_t SnapshotStore::Acquire() const {
+    // Start from a slot picked by the thread so that threads rarely compete for one
+    std::size_t slot = std::hash<std::thread::id>()(std::this_thread::get_id()) % slot_count_;
+    while (true) {
+        for (std::size_t tried = 0; tried < slot_count_; tried++, slot = (slot + 1) % slot_count_) {
+            bool is_taken = false;
+            if (!slots_[slot].is_taken.load(std::memory_order_relaxed) &&
+                slots_[slot].is_taken.compare_exchange_strong(is_taken, true, std::memory_order_acquire))
+                return slot;
+        }
+        std::this_thread::yield();
+    }
+}
+
+void SnapshotStore::Reclaim() {
+    std::vector<const MapSnapshot *> protected_snapshots;
+    for (std::size_t slot = 0; slot < slot_count_; slot++) {
+        const MapSnapshot *snapshot = slots_[slot].pointer.load();
+        if (snapshot != nullptr)
+            protected_snapshots.push_back(snapshot);
+    }
+    std::sort(protected_snapshots.begin(), protected_snapshots.end());
+    std::size_t kept = 0;
+    for (const auto *snapshot : retired_) {
+        if (std::binary_search(protected_snapshots.begin(), protected_snapshots.end(), snapshot))
+            retired_[kept++] = snapshot;
+        else
+            delete snapshot;
+    }
+    retired_.resize(kept);
+}
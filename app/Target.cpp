@@ -39,6 +39,7 @@
 #include "../include/RightState.h"
 #include "../include/RobotState.h"
 #include "../include/MobileRobot.h"
+#include "../include/Path.h"
 #include "../include/WheeledRobot.h"
 #include "../include/TrackedRobot.h"
 
@@ -149,8 +150,8 @@ int Target::GoWheeled() {
     } else {
         wheeled_maze_.SetStartGoal(wheeled_.x, wheeled_.y, bottle_.x, bottle_.y);
     }
-    wheeled_maze_.Action();
-    int is_blocked = wheeled_maze_.PlotTrajectory('|');
+    wheeled_maze_.Action(wheeled_path_);
+    int is_blocked = wheeled_maze_.PlotTrajectory(wheeled_path_.View(), '|');
     wheeled_maze_.ModifyMazePosition(wheeled_.x, wheeled_.y, 'w');
     if (wheeled_target_ == 'p') {
         wheeled_maze_.ModifyMazePosition(plate_.x, plate_.y, 'p');
@@ -158,7 +159,7 @@ int Target::GoWheeled() {
         wheeled_maze_.ModifyMazePosition(bottle_.x, bottle_.y, 'b');
     }
     wheeled_maze_.ShowMaze();
-    wheeled_maze_.BuildStack(wheeled_robot_in_maze_);
+    wheeled_maze_.BuildStack(wheeled_path_.View(), wheeled_robot_in_maze_);
     wheeled_robot_in_maze_->ShowStack();
     return is_blocked;
 }
@@ -169,8 +170,8 @@ int Target::GoTracked() {
     } else {
         tracked_maze_.SetStartGoal(tracked_.x, tracked_.y, bottle_.x, bottle_.y);
     }
-    tracked_maze_.Action();
-    int is_blocked = tracked_maze_.PlotTrajectory('-');
+    tracked_maze_.Action(tracked_path_);
+    int is_blocked = tracked_maze_.PlotTrajectory(tracked_path_.View(), '-');
     tracked_maze_.ModifyMazePosition(tracked_.x, tracked_.y, 't');
     if (tracked_target_ == 'p') {
         tracked_maze_.ModifyMazePosition(plate_.x, plate_.y, 'p');
@@ -178,23 +179,26 @@ int Target::GoTracked() {
         tracked_maze_.ModifyMazePosition(bottle_.x, bottle_.y, 'b');
     }
     tracked_maze_.ShowMaze();
-    tracked_maze_.BuildStack(tracked_robot_in_maze_);
+    tracked_maze_.BuildStack(tracked_path_.View(), tracked_robot_in_maze_);
     tracked_robot_in_maze_->ShowStack();
     return is_blocked;
 }
 
 void Target::PlotMaze() {
-    for (int j = temp_maze_.get_width() - 1; j >= 0; j--) {
-        for (int i = 0; i < temp_maze_.get_length(); i++) {
-            if (wheeled_maze_.GetMazePosition(i, j) == '|' and
-                tracked_maze_.GetMazePosition(i, j) == '-') {
-                temp_maze_.ModifyMazePosition(i, j, '+');
-            } else if (wheeled_maze_.GetMazePosition(i, j) == '|') {
-                temp_maze_.ModifyMazePosition(i, j, '|');
-            } else if (tracked_maze_.GetMazePosition(i, j) == '-') {
-                temp_maze_.ModifyMazePosition(i, j, '-');
-            }
-        }
+    // The start of a path is not marked, as in Maze::PlotTrajectory
+    const PathView wheeled = wheeled_path_.View();
+    for (auto node = wheeled.begin(); node != wheeled.end(); ++node) {
+        if (node != wheeled.begin())
+            temp_maze_.ModifyMazePosition(node->first, node->second, '|');
+    }
+    const PathView tracked = tracked_path_.View();
+    for (auto node = tracked.begin(); node != tracked.end(); ++node) {
+        if (node == tracked.begin())
+            continue;
+        if (temp_maze_.GetMazePosition(node->first, node->second) == '|')
+            temp_maze_.ModifyMazePosition(node->first, node->second, '+');
+        else
+            temp_maze_.ModifyMazePosition(node->first, node->second, '-');
     }
     temp_maze_.ModifyMazePosition(bottle_.x, bottle_.y, 'b');
     temp_maze_.ModifyMazePosition(plate_.x, plate_.y, 'p');
@@ -0,0 +1,109 @@
+/*
+ * @file        TerrainPlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file TerrainPlanner.cpp contains the definitions for TerrainPlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/BucketQueue.h"
+#include "../include/CostMap.h"
+#include "../include/MobileRobot.h"
+#include "../include/SearchWorkspace.h"
+#include "../include/TerrainPlanner.h"
+
+TerrainPlanner::TerrainPlanner(const BitGrid &grid, const CostMap &costs) : grid_{grid}, costs_{costs} {}
+
+int TerrainPlanner::FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                             const MobileRobot &robot, std::vector<std::pair<int, int>> &path) {
+    path.clear();
+    expansions_ = 0;
+    if (costs_.get_length() != grid_.get_length() || costs_.get_width() != grid_.get_width() ||
+        !grid_.IsWithinRegion(start) || !grid_.IsWithinRegion(goal) ||
+        !grid_.IsNotObstacle(start) || !grid_.IsNotObstacle(goal) ||
+        !CostMap::IsStopAllowed(costs_.get_terrain(goal)))
+        return -1;
+    // One virtual call per terrain class, then the search only reads the table
+    int cheapest = 255, dearest = 1;
+    for (int terrain = 0; terrain < 256; terrain++) {
+        const int cost = std::min(255, std::max(0, robot.get_terrain_cost(static_cast<std::uint8_t>(terrain))));
+        table_[terrain] = static_cast<std::uint8_t>(cost);
+        if (cost > 0) {
+            cheapest = std::min(cheapest, cost);
+            dearest = std::max(dearest, cost);
+        }
+    }
+    if (table_[costs_.get_terrain(goal)] == 0)
+        return -1;
+    // A move raises f by at most its cost plus the heuristic drop, both at most dearest
+    open_.Reset(2 * dearest);
+    SearchWorkspace &workspace = SearchWorkspace::Local();
+    workspace.Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    const int start_cell = grid_.ToIndex(start);
+    const int goal_cell = grid_.ToIndex(goal);
+    workspace.Update(start_cell, 0, start_cell);
+    open_.Push(cheapest * (std::abs(goal.first - start.first) + std::abs(goal.second - start.second)), start_cell);
+    bool is_found = false;
+    while (!open_.IsEmpty()) {
+        int priority = 0;
+        const int cell = open_.Pop(priority);
+        if (workspace.IsClosed(cell))
+            continue;
+        workspace.Close(cell);
+        expansions_++;
+        if (cell == goal_cell) {
+            is_found = true;
+            break;
+        }
+        const int cost = static_cast<int>(workspace.get_cost(cell));
+        const std::pair<int, int> node = grid_.ToNode(cell);
+        for (int move = 0; move < 4; move++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[move], node.second + BitGrid::kMoveY[move]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int next_cell = grid_.ToIndex(next);
+            const int step = table_[costs_.get_terrain(next_cell)];
+            if (step == 0 || workspace.IsClosed(next_cell) || cost + step >= workspace.get_cost(next_cell))
+                continue;
+            workspace.Update(next_cell, cost + step, cell);
+            open_.Push(cost + step + cheapest * (std::abs(goal.first - next.first) +
+                                                 std::abs(goal.second - next.second)), next_cell);
+        }
+    }
+    if (!is_found)
+        return -1;
+    for (int cell = goal_cell;; cell = workspace.get_parent(cell)) {
+        path.push_back(grid_.ToNode(cell));
+        if (cell == start_cell)
+            break;
+    }
+    std::reverse(path.begin(), path.end());
+    return static_cast<int>(workspace.get_cost(goal_cell));
+}
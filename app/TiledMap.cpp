@@ -0,0 +1,207 @@
+/*
+ * @file        TiledMap.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file TiledMap.cpp contains the definitions for TiledMap class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/TiledMap.h"
+
+/*! \brief Number of bytes of one 64x64 tile */
+static const std::size_t kTileBytes = 64 * sizeof(std::uint64_t);
+
+/*! \brief Alignment of the tile data, one page */
+static const std::uint64_t kPageBytes = 4096;
+
+/*!
+ * \brief Interleaves the bits of the tile coordinates (Z-order curve)
+ * \param tx - tile column
+ * \param ty - tile row
+ * \return Morton code of the tile
+ * */
+static std::uint64_t MortonCode(const std::uint32_t &tx, const std::uint32_t &ty) {
+    std::uint64_t code = 0;
+    for (int bit = 0; bit < 32; bit++) {
+        code |= static_cast<std::uint64_t>((tx >> bit) & 1u) << (2 * bit);
+        code |= static_cast<std::uint64_t>((ty >> bit) & 1u) << (2 * bit + 1);
+    }
+    return code;
+}
+
+/*!
+ * \brief Mask of the columns of a tile which lie inside the map
+ * \param tx - tile column
+ * \param length - number of columns of the map
+ * \return one bit per valid column
+ * */
+static std::uint64_t ColumnMask(const std::uint32_t &tx, const std::uint32_t &length) {
+    const std::uint32_t columns = std::min<std::uint32_t>(64, length - tx * 64);
+    return columns == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << columns) - 1;
+}
+
+const std::uint64_t TiledMap::kAllBlocked;
+const std::uint64_t TiledMap::kAllFree;
+
+TiledMap::~TiledMap() {
+    Close();
+}
+
+bool TiledMap::Save(const BitGrid &grid, const std::string &path) {
+    TiledMapHeader header;
+    header.length = static_cast<std::uint32_t>(grid.get_length());
+    header.width = static_cast<std::uint32_t>(grid.get_width());
+    header.tiles_x = (header.length + 63) / 64;
+    header.tiles_y = (header.width + 63) / 64;
+    header.index_offset = sizeof(TiledMapHeader);
+    const std::size_t tile_count = static_cast<std::size_t>(header.tiles_x) * header.tiles_y;
+    std::vector<std::uint64_t> index(tile_count, kAllBlocked);
+    std::vector<std::uint64_t> tiles(tile_count * 64, 0);
+    std::vector<std::uint32_t> stored;
+    for (std::uint32_t ty = 0; ty < header.tiles_y; ty++) {
+        for (std::uint32_t tx = 0; tx < header.tiles_x; tx++) {
+            const std::size_t tile = static_cast<std::size_t>(ty) * header.tiles_x + tx;
+            const std::uint64_t mask = ColumnMask(tx, header.length);
+            const std::uint32_t rows = std::min<std::uint32_t>(64, header.width - ty * 64);
+            bool is_all_free = true, is_all_blocked = true;
+            for (std::uint32_t r = 0; r < rows; r++) {
+                const std::uint64_t word = grid.Row(static_cast<int>(ty * 64 + r))[tx] & mask;
+                tiles[tile * 64 + r] = word;
+                is_all_free = is_all_free && word == mask;
+                is_all_blocked = is_all_blocked && word == 0;
+            }
+            if (is_all_free)
+                index[tile] = kAllFree;
+            else if (!is_all_blocked)
+                stored.push_back(static_cast<std::uint32_t>(tile));
+        }
+    }
+    std::sort(stored.begin(), stored.end(), [&header](const std::uint32_t &a, const std::uint32_t &b) {
+        return MortonCode(a % header.tiles_x, a / header.tiles_x) <
+               MortonCode(b % header.tiles_x, b / header.tiles_x);
+    });
+    header.stored_tiles = static_cast<std::uint32_t>(stored.size());
+    const std::uint64_t index_end = header.index_offset + tile_count * sizeof(std::uint64_t);
+    header.data_offset = (index_end + kPageBytes - 1) / kPageBytes * kPageBytes;
+    for (std::size_t k = 0; k < stored.size(); k++)
+        index[stored[k]] = header.data_offset + k * kTileBytes;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cout << "Save map failed, cannot open " << path << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(index.data()),
+               static_cast<std::streamsize>(index.size() * sizeof(std::uint64_t)));
+    const std::vector<char> padding(static_cast<std::size_t>(header.data_offset - index_end), 0);
+    file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    for (const auto &tile : stored)
+        file.write(reinterpret_cast<const char *>(&tiles[static_cast<std::size_t>(tile) * 64]), kTileBytes);
+    if (!file) {
+        std::cout << "Save map failed, cannot write " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TiledMap::Open(const std::string &path) {
+    Close();
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cout << "Open map failed, cannot open " << path << std::endl;
+        return false;
+    }
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(TiledMapHeader)) {
+        std::cout << "Open map failed, " << path << " is too short" << std::endl;
+        close(fd);
+        return false;
+    }
+    void *mapping = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cout << "Open map failed, cannot map " << path << std::endl;
+        return false;
+    }
+    base_ = static_cast<const unsigned char *>(mapping);
+    size_ = static_cast<std::size_t>(info.st_size);
+    header_ = reinterpret_cast<const TiledMapHeader *>(base_);
+    const TiledMapHeader expected;
+    const std::uint64_t tile_count = static_cast<std::uint64_t>(header_->tiles_x) * header_->tiles_y;
+    bool is_valid = std::memcmp(header_->magic, expected.magic, sizeof(expected.magic)) == 0 &&
+                    header_->version == expected.version && header_->tile_size == expected.tile_size &&
+                    header_->tiles_x == (header_->length + 63) / 64 &&
+                    header_->tiles_y == (header_->width + 63) / 64 &&
+                    header_->index_offset % sizeof(std::uint64_t) == 0 &&
+                    header_->index_offset + tile_count * sizeof(std::uint64_t) <= size_;
+    if (is_valid) {
+        index_ = reinterpret_cast<const std::uint64_t *>(base_ + header_->index_offset);
+        for (std::uint64_t tile = 0; tile < tile_count && is_valid; tile++) {
+            is_valid = index_[tile] <= kAllFree ||
+                       (index_[tile] % sizeof(std::uint64_t) == 0 && index_[tile] + kTileBytes <= size_);
+        }
+    }
+    if (!is_valid) {
+        std::cout << "Open map failed, " << path << " is not a valid tiled map" << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void TiledMap::Close() {
+    if (base_ != nullptr)
+        munmap(const_cast<unsigned char *>(base_), size_);
+    base_ = nullptr;
+    size_ = 0;
+    header_ = nullptr;
+    index_ = nullptr;
+}
+
+void TiledMap::CopyTo(BitGrid &grid) const {
+    grid = BitGrid(get_length(), get_width());
+    for (std::uint32_t ty = 0; ty < header_->tiles_y; ty++) {
+        const std::uint32_t rows = std::min<std::uint32_t>(64, header_->width - ty * 64);
+        for (std::uint32_t tx = 0; tx < header_->tiles_x; tx++) {
+            const std::uint64_t entry = index_[static_cast<std::size_t>(ty) * header_->tiles_x + tx];
+            const std::uint64_t mask = ColumnMask(tx, header_->length);
+            const std::uint64_t *words = reinterpret_cast<const std::uint64_t *>(base_ + entry);
+            for (std::uint32_t r = 0; r < rows; r++) {
+                const std::uint64_t word = entry <= kAllFree ? (entry == kAllFree ? mask : 0) : words[r] & mask;
+                grid.Row(static_cast<int>(ty * 64 + r))[tx] = word;
+            }
+        }
+    }
+}
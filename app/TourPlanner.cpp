@@ -0,0 +1,276 @@
+/*
+ * @file        TourPlanner.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file TourPlanner.cpp contains the definitions for TourPlanner class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Path.h"
+#include "../include/TourPlanner.h"
+
+const int TourPlanner::kExactStops;
+
+int TourPlanner::Plan(const std::pair<int, int> &start, const std::vector<std::pair<int, int>> &stops,
+                      const bool &is_returning, Path &path) {
+    path.Clear();
+    order_.clear();
+    if (!grid_.IsWithinRegion(start) || !grid_.IsNotObstacle(start)) {
+        std::cout << "Plan tour failed, the start is blocked or outside the map" << std::endl;
+        return -1;
+    }
+    cells_.assign(1, grid_.ToIndex(start));
+    for (std::size_t i = 0; i < stops.size(); i++) {
+        if (!grid_.IsWithinRegion(stops[i]) || !grid_.IsNotObstacle(stops[i])) {
+            std::cout << "Plan tour failed, stop " << i << " is blocked or outside the map" << std::endl;
+            return -1;
+        }
+        cells_.push_back(grid_.ToIndex(stops[i]));
+    }
+    points_ = static_cast<int>(cells_.size());
+    const int unreachable = BuildMatrix();
+    if (unreachable >= 0) {
+        std::cout << "Plan tour failed, stop " << unreachable - 1 << " cannot be reached" << std::endl;
+        return -1;
+    }
+
+    // The sequence starts and ends at fixed points, the stops in between are ordered
+    sequence_.resize(static_cast<std::size_t>(points_) + 1);
+    for (int i = 0; i < points_; i++)
+        sequence_[i] = i;
+    sequence_.back() = is_returning ? 0 : points_;
+    if (points_ - 1 <= kExactStops)
+        OrderExactly();
+    else
+        OrderLocally();
+
+    int moves = 0;
+    std::vector<std::pair<int, int>> nodes{start};
+    for (std::size_t i = 0; i + 1 < sequence_.size(); i++) {
+        if (sequence_[i + 1] == points_)
+            break;
+        moves += Leg(sequence_[i], sequence_[i + 1]);
+        AppendLeg(sequence_[i], sequence_[i + 1], nodes);
+    }
+    for (std::size_t i = 1; i + 1 < sequence_.size(); i++)
+        order_.push_back(sequence_[i] - 1);
+    path.Assign(nodes);
+    return moves;
+}
+
+int TourPlanner::BuildMatrix() {
+    distances_.assign(static_cast<std::size_t>(points_) * points_, -1);
+    for (int i = 0; i < points_; i++)
+        distances_[i * points_ + i] = 0;
+    std::vector<std::pair<int, int>> targets;
+    std::vector<int> queue;
+    for (int i = 0; i + 1 < points_; i++) {
+        // The later points, by cell, since several stops may share one
+        targets.clear();
+        for (int j = i + 1; j < points_; j++)
+            targets.emplace_back(cells_[j], j);
+        std::sort(targets.begin(), targets.end());
+        std::size_t remaining = targets.size();
+        moves_.assign(static_cast<std::size_t>(grid_.get_cell_count()), -1);
+        queue.assign(1, cells_[i]);
+        moves_[cells_[i]] = 0;
+        for (std::size_t head = 0; head < queue.size() && remaining > 0; head++) {
+            const int cell = queue[head];
+            for (auto target = std::lower_bound(targets.begin(), targets.end(), std::make_pair(cell, 0));
+                 target != targets.end() && target->first == cell; ++target) {
+                distances_[i * points_ + target->second] = moves_[cell];
+                distances_[target->second * points_ + i] = moves_[cell];
+                remaining--;
+            }
+            const std::pair<int, int> node = grid_.ToNode(cell);
+            for (int d = 0; d < 4; d++) {
+                const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+                if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                    continue;
+                const int next_cell = grid_.ToIndex(next);
+                if (moves_[next_cell] < 0) {
+                    moves_[next_cell] = moves_[cell] + 1;
+                    queue.push_back(next_cell);
+                }
+            }
+        }
+        // Every point reaches the start if the start reaches them all, so only the
+        // search from the start can miss one
+        if (remaining > 0) {
+            for (int j = i + 1; j < points_; j++) {
+                if (distances_[i * points_ + j] < 0)
+                    return j;
+            }
+        }
+    }
+    return -1;
+}
+
+void TourPlanner::OrderExactly() {
+    const int stops = points_ - 1;
+    if (stops < 2)
+        return;
+    const int end = sequence_.back();
+    const std::size_t sets = static_cast<std::size_t>(1) << stops;
+    // cost[set * stops + last]: shortest way from the start through the stops of the
+    // set, ending at stop last of the set
+    std::vector<int> cost(sets * stops, INT_MAX);
+    std::vector<signed char> previous(sets * stops, -1);
+    for (int k = 0; k < stops; k++)
+        cost[(static_cast<std::size_t>(1) << k) * stops + k] = Leg(0, k + 1);
+    for (std::size_t set = 1; set < sets; set++) {
+        for (int last = 0; last < stops; last++) {
+            const int current = cost[set * stops + last];
+            if (current == INT_MAX)
+                continue;
+            for (int next = 0; next < stops; next++) {
+                if (set & (static_cast<std::size_t>(1) << next))
+                    continue;
+                const std::size_t state = (set | (static_cast<std::size_t>(1) << next)) * stops + next;
+                if (current + Leg(last + 1, next + 1) < cost[state]) {
+                    cost[state] = current + Leg(last + 1, next + 1);
+                    previous[state] = static_cast<signed char>(last);
+                }
+            }
+        }
+    }
+    int best = INT_MAX, last = 0;
+    for (int k = 0; k < stops; k++) {
+        const int total = cost[(sets - 1) * stops + k] + Leg(k + 1, end);
+        if (total < best) {
+            best = total;
+            last = k;
+        }
+    }
+    std::size_t set = sets - 1;
+    for (int position = stops; position >= 1; position--) {
+        sequence_[position] = last + 1;
+        const int before = previous[set * stops + last];
+        set &= ~(static_cast<std::size_t>(1) << last);
+        last = before;
+    }
+}
+
+void TourPlanner::OrderLocally() {
+    std::vector<int> &s = sequence_;
+    const int count = points_ - 1;
+
+    // Nearest neighbour
+    for (int position = 1; position <= count; position++) {
+        int nearest = position;
+        for (int k = position + 1; k <= count; k++) {
+            if (Leg(s[position - 1], s[k]) < Leg(s[position - 1], s[nearest]))
+                nearest = k;
+        }
+        std::swap(s[position], s[nearest]);
+    }
+
+    bool is_improved = true;
+    while (is_improved) {
+        is_improved = false;
+        // 2-opt: reverses the stops from i to j
+        for (int i = 1; i < count; i++) {
+            for (int j = i + 1; j <= count; j++) {
+                const int change = Leg(s[i - 1], s[j]) + Leg(s[i], s[j + 1]) -
+                                   Leg(s[i - 1], s[i]) - Leg(s[j], s[j + 1]);
+                if (change < 0) {
+                    std::reverse(s.begin() + i, s.begin() + j + 1);
+                    is_improved = true;
+                }
+            }
+        }
+        // Or-opt: moves the run of stops from i to i + run - 1 between two other points,
+        // reversed or not
+        for (int run = 1; run <= 3; run++) {
+            for (int i = 1; i + run - 1 <= count; i++) {
+                const int first = s[i], last = s[i + run - 1];
+                const int before = s[i - 1], after = s[i + run];
+                const int saving = Leg(before, first) + Leg(last, after) - Leg(before, after);
+                int best = 0, best_k = -1;
+                bool is_reversed = false;
+                for (int k = 0; k <= count; k++) {
+                    if (k >= i - 1 && k <= i + run - 1)
+                        continue;
+                    const int p = s[k], q = s[k + 1];
+                    const int forward = Leg(p, first) + Leg(last, q) - Leg(p, q) - saving;
+                    const int backward = Leg(p, last) + Leg(first, q) - Leg(p, q) - saving;
+                    if (std::min(forward, backward) < best) {
+                        best = std::min(forward, backward);
+                        best_k = k;
+                        is_reversed = backward < forward;
+                    }
+                }
+                if (best_k < 0)
+                    continue;
+                std::vector<int> moved(s.begin() + i, s.begin() + i + run);
+                if (is_reversed)
+                    std::reverse(moved.begin(), moved.end());
+                s.erase(s.begin() + i, s.begin() + i + run);
+                const int insert = best_k < i ? best_k + 1 : best_k + 1 - run;
+                s.insert(s.begin() + insert, moved.begin(), moved.end());
+                is_improved = true;
+            }
+        }
+    }
+}
+
+void TourPlanner::AppendLeg(const int &from, const int &to, std::vector<std::pair<int, int>> &nodes) {
+    // A* from the end of the leg, so that the parents lead from its start to its end
+    const int from_cell = cells_[from], to_cell = cells_[to];
+    const std::pair<int, int> target = grid_.ToNode(from_cell);
+    workspace_.Reset(static_cast<std::size_t>(grid_.get_cell_count()));
+    workspace_.Update(to_cell, 0, to_cell);
+    workspace_.Push(0, to_cell);
+    while (!workspace_.IsEmpty()) {
+        const HeapEntry entry = workspace_.Pop();
+        if (workspace_.IsClosed(entry.state))
+            continue;
+        workspace_.Close(entry.state);
+        if (entry.state == from_cell)
+            break;
+        const std::pair<int, int> node = grid_.ToNode(entry.state);
+        const double cost = workspace_.get_cost(entry.state) + 1;
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{node.first + BitGrid::kMoveX[d], node.second + BitGrid::kMoveY[d]};
+            if (!grid_.IsWithinRegion(next) || !grid_.IsNotObstacle(next))
+                continue;
+            const int next_cell = grid_.ToIndex(next);
+            if (cost < workspace_.get_cost(next_cell)) {
+                workspace_.Update(next_cell, cost, entry.state);
+                workspace_.Push(cost + std::abs(next.first - target.first) + std::abs(next.second - target.second),
+                                next_cell);
+            }
+        }
+    }
+    for (int cell = from_cell; cell != to_cell;) {
+        cell = workspace_.get_parent(cell);
+        nodes.push_back(grid_.ToNode(cell));
+    }
+}
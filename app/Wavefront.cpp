@@ -0,0 +1,257 @@
+/*
+ * @file        Wavefront.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file Wavefront.cpp contains the definitions for Wavefront class
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/TiledMap.h"
+#include "../include/Wavefront.h"
+
+/*! \brief Bits of column 0 and column 7 of an 8x8 block */
+static const std::uint64_t kFirstColumn = 0x0101010101010101ULL;
+static const std::uint64_t kLastColumn = 0x8080808080808080ULL;
+
+/*!
+ * \brief Index of the lowest set bit of a non-zero word
+ * \param word - word to be scanned
+ * \return bit index in [0, 63]
+ * */
+static inline int LowestBit(const std::uint64_t &word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(word);
+#else
+    int bit = 0;
+    while (((word >> bit) & 1u) == 0)
+        bit++;
+    return bit;
+#endif
+}
+
+/*!
+ * \brief Number of set bits of a word
+ * \param word - word to be counted
+ * \return bit count in [0, 64]
+ * */
+static inline int CountBits(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    int count = 0;
+    for (; word != 0; word &= word - 1)
+        count++;
+    return count;
+#endif
+}
+
+Wavefront::Wavefront(const BitGrid &grid)
+        : grid_{&grid}, length_{grid.get_length()}, width_{grid.get_width()},
+          blocks_x_{(length_ + 7) / 8}, blocks_y_{(width_ + 7) / 8},
+          free_(static_cast<std::size_t>(blocks_x_) * blocks_y_, 0),
+          frontier_(free_.size(), 0), next_(free_.size(), 0), visited_(free_.size(), 0),
+          mark_(free_.size(), 0) {
+    Refresh();
+}
+
+Wavefront::Wavefront(const TiledMap &map)
+        : map_{&map}, length_{map.get_length()}, width_{map.get_width()},
+          blocks_x_{(length_ + 7) / 8}, blocks_y_{(width_ + 7) / 8},
+          free_(static_cast<std::size_t>(blocks_x_) * blocks_y_, 0),
+          frontier_(free_.size(), 0), next_(free_.size(), 0), visited_(free_.size(), 0),
+          mark_(free_.size(), 0) {
+    Refresh();
+}
+
+template <typename Grid>
+void Wavefront::Fill(const Grid &grid) {
+    std::fill(free_.begin(), free_.end(), 0);
+    for (int y = 0; y < width_; y++) {
+        for (int x = 0; x < length_; x++) {
+            if (grid.IsNotObstacle(std::make_pair(x, y)))
+                free_[BlockOf(x, y)] |= std::uint64_t{1} << BitOf(x, y);
+        }
+    }
+}
+
+void Wavefront::Refresh() {
+    if (grid_ != nullptr)
+        Fill(*grid_);
+    else
+        Fill(*map_);
+}
+
+bool Wavefront::Seed(const std::pair<int, int> &source) {
+    std::fill(visited_.begin(), visited_.end(), 0);
+    for (const auto &block : active_)
+        frontier_[block] = 0;
+    active_.clear();
+    reached_ = 0;
+    if (!IsFree(source))
+        return false;
+    reached_ = 1;
+    const int block = BlockOf(source.first, source.second);
+    frontier_[block] = std::uint64_t{1} << BitOf(source.first, source.second);
+    visited_[block] = frontier_[block];
+    active_.push_back(block);
+    return true;
+}
+
+bool Wavefront::Advance(const int &level, std::vector<int> *distance) {
+    stamp_++;
+    if (stamp_ == 0) {
+        std::fill(mark_.begin(), mark_.end(), 0);
+        stamp_ = 1;
+    }
+    next_active_.clear();
+    for (const auto &block : active_) {
+        // A block can only gain cells if it, or one of its four neighbours, is on the frontier
+        const int bx = block % blocks_x_;
+        const int candidates[5] = {block, bx > 0 ? block - 1 : -1, bx + 1 < blocks_x_ ? block + 1 : -1,
+                                   block >= blocks_x_ ? block - blocks_x_ : -1,
+                                   block + blocks_x_ < static_cast<int>(free_.size()) ? block + blocks_x_ : -1};
+        for (const auto &candidate : candidates) {
+            if (candidate < 0 || mark_[candidate] == stamp_)
+                continue;
+            mark_[candidate] = stamp_;
+            const std::uint64_t fresh = Reach(candidate) & free_[candidate] & ~visited_[candidate];
+            if (fresh == 0)
+                continue;
+            next_[candidate] = fresh;
+            visited_[candidate] |= fresh;
+            reached_ += static_cast<std::uint64_t>(CountBits(fresh));
+            next_active_.push_back(candidate);
+        }
+    }
+    if (distance != nullptr) {
+        const int length = length_;
+        for (const auto &block : next_active_) {
+            const int x0 = (block % blocks_x_) * 8, y0 = (block / blocks_x_) * 8;
+            std::uint64_t fresh = next_[block];
+            while (fresh != 0) {
+                const int bit = LowestBit(fresh);
+                (*distance)[static_cast<std::size_t>(y0 + (bit >> 3)) * length + x0 + (bit & 7)] = level;
+                fresh &= fresh - 1;
+            }
+        }
+    }
+    // Clear the old frontier so that the swapped-in buffer starts empty
+    for (const auto &block : active_)
+        frontier_[block] = 0;
+    frontier_.swap(next_);
+    active_.swap(next_active_);
+    return !active_.empty();
+}
+
+std::uint64_t Wavefront::Reach(const int &block) const {
+    const int bx = block % blocks_x_;
+    const std::uint64_t f = frontier_[block];
+    // Moves inside the block: East/West are one bit shifts, North/South are one row (8 bit) shifts
+    std::uint64_t reach = ((f << 1) & ~kFirstColumn) | ((f >> 1) & ~kLastColumn) | (f << 8) | (f >> 8);
+    // Moves entering from the neighbouring blocks through their facing column or row
+    if (bx > 0)
+        reach |= (frontier_[block - 1] >> 7) & kFirstColumn;
+    if (bx + 1 < blocks_x_)
+        reach |= (frontier_[block + 1] << 7) & kLastColumn;
+    if (block >= blocks_x_)
+        reach |= frontier_[block - blocks_x_] >> 56;
+    if (block + blocks_x_ < static_cast<int>(frontier_.size()))
+        reach |= frontier_[block + blocks_x_] << 56;
+    return reach;
+}
+
+int Wavefront::DistanceMap(const std::pair<int, int> &source, std::vector<int> &distance) {
+    distance.assign(static_cast<std::size_t>(length_) * width_, -1);
+    if (!Seed(source))
+        return -1;
+    distance[ToIndex(source)] = 0;
+    int level = 0;
+    while (Advance(level + 1, &distance))
+        level++;
+    return level;
+}
+
+bool Wavefront::IsVisited(const std::pair<int, int> &node) const {
+    return ((visited_[BlockOf(node.first, node.second)] >> BitOf(node.first, node.second)) & 1u) != 0;
+}
+
+int Wavefront::ShortestLength(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    if (!IsFree(goal) || !Seed(start))
+        return -1;
+    int level = 0;
+    while (!IsVisited(goal)) {
+        if (!Advance(level + 1, nullptr))
+            return -1;
+        level++;
+    }
+    return level;
+}
+
+bool Wavefront::IsReachable(const std::pair<int, int> &start, const std::pair<int, int> &goal) {
+    return ShortestLength(start, goal) >= 0;
+}
+
+int Wavefront::ShortestPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                            std::vector<std::pair<int, int>> &path) {
+    path.clear();
+    // Grow the wavefront from the goal so that walking down the map yields start -> goal order
+    path_distance_.assign(static_cast<std::size_t>(length_) * width_, -1);
+    if (!IsFree(start) || !Seed(goal))
+        return -1;
+    path_distance_[ToIndex(goal)] = 0;
+    int level = 0;
+    while (!IsVisited(start)) {
+        if (!Advance(level + 1, &path_distance_))
+            return -1;
+        level++;
+    }
+    return Descend(path_distance_, start, path);
+}
+
+int Wavefront::Descend(const std::vector<int> &distance, const std::pair<int, int> &node,
+                       std::vector<std::pair<int, int>> &path) const {
+    path.clear();
+    if (!IsWithinRegion(node) || distance[ToIndex(node)] < 0)
+        return -1;
+    std::pair<int, int> current = node;
+    int remaining = distance[ToIndex(current)];
+    path.reserve(static_cast<std::size_t>(remaining) + 1);
+    path.push_back(current);
+    while (remaining > 0) {
+        for (int d = 0; d < 4; d++) {
+            const std::pair<int, int> next{current.first + BitGrid::kMoveX[d], current.second + BitGrid::kMoveY[d]};
+            if (IsWithinRegion(next) && distance[ToIndex(next)] == remaining - 1) {
+                current = next;
+                break;
+            }
+        }
+        path.push_back(current);
+        remaining--;
+    }
+    return static_cast<int>(path.size()) - 1;
+}
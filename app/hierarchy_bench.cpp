@@ -0,0 +1,160 @@
+/*
+ * @file        hierarchy_bench.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file hierarchy_bench.cpp generates a map, builds its contraction
+ *              hierarchy and times random queries, checking a sample against the wavefront
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/ContractionHierarchy.h"
+#include "../include/MapGenerator.h"
+#include "../include/Path.h"
+#include "../include/Wavefront.h"
+
+namespace {
+
+/*! \brief Queries checked against the wavefront, a full breadth first search each */
+const std::size_t kCheckedQueries = 50;
+
+/*! \brief Picks a random free node of a map */
+std::pair<int, int> RandomFreeNode(const BitGrid &grid, std::mt19937_64 &random) {
+    std::uniform_int_distribution<int> x(0, grid.get_length() - 1), y(0, grid.get_width() - 1);
+    while (true) {
+        const std::pair<int, int> node(x(random), y(random));
+        if (grid.IsNotObstacle(node))
+            return node;
+    }
+}
+
+/*! \brief Checks that a path joins start to goal in the given number of moves through free cells */
+bool IsValidPath(const BitGrid &grid, const Path &path, const std::pair<int, int> &start,
+                 const std::pair<int, int> &goal, const int &length) {
+    if (path.IsEmpty() || static_cast<int>(path.get_move_count()) != length)
+        return false;
+    std::pair<int, int> last(-1, -1);
+    for (const auto &node : path.View()) {
+        if (!grid.IsNotObstacle(node))
+            return false;
+        last = node;
+    }
+    return path.View().get_start() == start && last == goal;
+}
+
+/*! \brief Value at a fraction of sorted samples */
+double Percentile(const std::vector<double> &sorted, const double &fraction) {
+    return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(fraction * sorted.size()))];
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc > 1 && MapGenerator::KindOf(argv[1]) < 0) {
+        std::cout << "Usage: " << argv[0] << " [perfect|braided|rooms|warehouse] [length] [width]"
+                     " [queries] [seed] [threads]" << std::endl;
+        return 1;
+    }
+    const std::string layout = argc > 1 ? argv[1] : "warehouse";
+    MapOptions options;
+    options.length = argc > 2 ? std::atoi(argv[2]) : 2048;
+    options.width = argc > 3 ? std::atoi(argv[3]) : 2048;
+    const int queries = argc > 4 ? std::max(1, std::atoi(argv[4])) : 100000;
+    if (argc > 5)
+        options.seed = std::strtoull(argv[5], nullptr, 10);
+    if (argc > 6)
+        options.threads = std::atoi(argv[6]);
+    BitGrid grid;
+    if (!MapGenerator(options).Generate(MapGenerator::KindOf(layout), grid)) {
+        std::cout << "Map smaller than 3 x 3" << std::endl;
+        return 1;
+    }
+    ContractionHierarchy hierarchy;
+    const auto begin = std::chrono::steady_clock::now();
+    const std::size_t shortcuts = hierarchy.Build(grid, options.threads);
+    const double build_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << "Built a " << options.length << " x " << options.width << " " << layout << " map with "
+              << hierarchy.get_node_count() << " free cells in " << build_seconds << " s: " << shortcuts
+              << " shortcuts, " << hierarchy.get_bytes() / (1024 * 1024) << " MiB" << std::endl;
+
+    // The distances and the paths are timed in separate passes, so that the unpacking of a
+    // path does not evict the arcs the next distance query reads
+    std::mt19937_64 random(options.seed);
+    std::vector<std::pair<std::pair<int, int>, std::pair<int, int>>> ends(static_cast<std::size_t>(queries));
+    for (auto &pair : ends)
+        pair = std::make_pair(RandomFreeNode(grid, random), RandomFreeNode(grid, random));
+    std::vector<int> distances(ends.size());
+    std::vector<double> distance_us(ends.size()), path_us(ends.size());
+    std::uint64_t settled = 0;
+    for (std::size_t query = 0; query < ends.size(); query++) {
+        const auto query_begin = std::chrono::steady_clock::now();
+        distances[query] = hierarchy.Distance(ends[query].first, ends[query].second);
+        distance_us[query] =
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - query_begin).count();
+        settled += static_cast<std::uint64_t>(hierarchy.get_settled());
+    }
+    Path path;
+    for (std::size_t query = 0; query < ends.size(); query++) {
+        const auto query_begin = std::chrono::steady_clock::now();
+        hierarchy.FindPath(ends[query].first, ends[query].second, path);
+        path_us[query] =
+                std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - query_begin).count();
+    }
+    Wavefront wavefront(grid);
+    int wrong = 0;
+    for (std::size_t query = 0; query < ends.size() && query < kCheckedQueries; query++) {
+        const std::pair<int, int> &start = ends[query].first, &goal = ends[query].second;
+        const int expected = wavefront.ShortestLength(start, goal);
+        const int length = hierarchy.FindPath(start, goal, path);
+        if (distances[query] != expected || length != expected ||
+            (expected >= 0 && !IsValidPath(grid, path, start, goal, expected))) {
+            std::cout << "Wrong answer from (" << start.first << ", " << start.second << ") to (" << goal.first
+                      << ", " << goal.second << "): " << distances[query] << " moves, expected " << expected
+                      << std::endl;
+            wrong++;
+        }
+    }
+    std::sort(distance_us.begin(), distance_us.end());
+    std::sort(path_us.begin(), path_us.end());
+    std::cout << queries << " queries, " << static_cast<double>(settled) / queries << " nodes settled on average"
+              << std::endl;
+    std::cout << "Distance: median " << Percentile(distance_us, 0.5) << " us, p99 " << Percentile(distance_us, 0.99)
+              << " us" << std::endl;
+    std::cout << "Path: median " << Percentile(path_us, 0.5) << " us, p99 " << Percentile(path_us, 0.99) << " us"
+              << std::endl;
+    if (wrong > 0) {
+        std::cout << wrong << " of the first " << std::min(ends.size(), kCheckedQueries)
+                  << " queries differ from the wavefront" << std::endl;
+        return 2;
+    }
+    return 0;
+}
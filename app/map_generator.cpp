@@ -0,0 +1,69 @@
+/*
+ * @file        map_generator.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file map_generator.cpp contains the main function of the map generator
+ *              tool, which writes generated layouts in the tiled map format
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "../include/BitGrid.h"
+#include "../include/MapGenerator.h"
+#include "../include/TiledMap.h"
+
+int main(int argc, char **argv) {
+    if (argc < 5) {
+        std::cout << "Usage: " << argv[0] << " <perfect|braided|rooms|warehouse> <length> <width>"
+                     " <output tiled map> [seed] [threads]" << std::endl;
+        return 1;
+    }
+    const int kind = MapGenerator::KindOf(argv[1]);
+    MapOptions options;
+    options.length = std::atoi(argv[2]);
+    options.width = std::atoi(argv[3]);
+    if (argc >= 6)
+        options.seed = std::strtoull(argv[5], nullptr, 10);
+    if (argc >= 7)
+        options.threads = std::atoi(argv[6]);
+    if (kind < 0 || options.length < 3 || options.width < 3) {
+        std::cout << "Unknown layout or map smaller than 3 x 3" << std::endl;
+        return 1;
+    }
+    const auto begin = std::chrono::steady_clock::now();
+    BitGrid grid;
+    MapGenerator(options).Generate(kind, grid);
+    const auto generated = std::chrono::steady_clock::now();
+    if (!TiledMap::Save(grid, argv[4]))
+        return 1;
+    const auto saved = std::chrono::steady_clock::now();
+    std::cout << "Generated a " << options.length << " x " << options.width << " " << argv[1] << " map in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(generated - begin).count()
+              << " ms, saved in "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(saved - generated).count()
+              << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * @file        mission_soak.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file mission_soak.cpp runs planning missions in a loop and tracks the
+ *              allocations and the resident memory of the process, to catch leaks
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../include/AllocationCounter.h"
+#include "../include/Maze.h"
+#include "../include/MobileRobot.h"
+#include "../include/Path.h"
+#include "../include/PlannerMetrics.h"
+#include "../include/TrackedRobot.h"
+#include "../include/WheeledRobot.h"
+
+namespace {
+
+/*! \brief Resident set size of the process in bytes, 0 if it cannot be read */
+std::uint64_t ResidentBytes() {
+    std::ifstream statm("/proc/self/statm");
+    std::uint64_t pages = 0, resident = 0;
+    if (!(statm >> pages >> resident))
+        return 0;
+    return resident * static_cast<std::uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+/*! \brief Picks a random free node of a maze */
+std::pair<int, int> RandomFreeNode(const Maze &maze, std::mt19937_64 &random) {
+    std::uniform_int_distribution<int> x(0, maze.get_length() - 1), y(0, maze.get_width() - 1);
+    while (true) {
+        const std::pair<int, int> node(x(random), y(random));
+        if (maze.IsNotObstacle(node))
+            return node;
+    }
+}
+
+/*! \brief Largest RSS growth after warm-up taken as noise, in bytes per 1000 missions */
+const double kRssSlopeLimit = 16384;
+
+/*! \brief Largest average of bytes a mission may leave allocated after warm-up */
+const double kLiveBytesLimit = 1;
+
+/*! \brief Totals of the missions over some period */
+struct Totals {
+    std::uint64_t missions = 0, allocations = 0, bytes = 0;
+    std::int64_t peak_live_bytes = 0, live_bytes = 0;
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const std::uint64_t missions = argc >= 2 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const std::uint64_t report_every = argc >= 3 ? std::strtoull(argv[2], nullptr, 10) : 100000;
+    const std::uint64_t seed = argc >= 4 ? std::strtoull(argv[3], nullptr, 10) : 1;
+    if (missions == 0 || report_every == 0) {
+        std::cout << "Usage: " << argv[0] << " [missions] [report every] [seed]" << std::endl;
+        return 1;
+    }
+    if (!AllocationCounter::kIsEnabled)
+        std::cout << "Allocation counting is off, only the resident memory is tracked "
+                     "(configure with -DMAZE_ENABLE_ALLOCATION_COUNTING=ON)" << std::endl;
+
+    // ShowStack prints the whole stack, so stdout goes to /dev/null around it
+    std::cout.flush();
+    const int terminal = dup(STDOUT_FILENO);
+    const int null_device = open("/dev/null", O_WRONLY);
+    if (terminal < 0 || null_device < 0) {
+        std::cout << "Could not open /dev/null" << std::endl;
+        return 1;
+    }
+
+    PlannerMetrics metrics;
+    std::mt19937_64 random(seed);
+    // The first period warms the allocator, the search workspace of the thread and the
+    // metrics up, so only the periods after it are checked for leaks
+    Totals period, settled;
+    std::vector<std::pair<double, double>> samples;
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::uint64_t mission = 1; mission <= missions; mission++) {
+        const AllocationScope allocations;
+        {
+            // A mission of Target: search, plot, build the stack of the robot and show it
+            Maze maze;
+            std::shared_ptr<MobileRobot> robot;
+            if (mission % 2 == 0)
+                robot = std::make_shared<TrackedRobot>();
+            else
+                robot = std::make_shared<WheeledRobot>();
+            maze.set_metrics(&metrics, robot->get_name());
+            const std::pair<int, int> start = RandomFreeNode(maze, random);
+            const std::pair<int, int> goal = RandomFreeNode(maze, random);
+            maze.SetStartGoal(start.first, start.second, goal.first, goal.second);
+            Path path;
+            maze.Action(path);
+            maze.PlotTrajectory(path.View(), '|');
+            if (!path.IsEmpty()) {
+                maze.BuildStack(path.View(), robot);
+                std::fflush(stdout);
+                dup2(null_device, STDOUT_FILENO);
+                robot->ShowStack();
+                std::fflush(stdout);
+                dup2(terminal, STDOUT_FILENO);
+            }
+        }
+        const AllocationStats stats = allocations.get_stats();
+        for (Totals *sum : {&period, &settled}) {
+            if (sum == &settled && samples.empty())
+                continue;
+            sum->missions++;
+            sum->allocations += stats.allocations;
+            sum->bytes += stats.bytes;
+            sum->live_bytes += stats.live_bytes;
+            sum->peak_live_bytes = std::max(sum->peak_live_bytes, stats.peak_live_bytes);
+        }
+        if (mission % report_every != 0 && mission != missions)
+            continue;
+
+        const std::uint64_t rss = ResidentBytes();
+        samples.emplace_back(static_cast<double>(mission), static_cast<double>(rss));
+        const double count = static_cast<double>(period.missions);
+        std::cout << mission << " missions, "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(
+                          std::chrono::steady_clock::now() - begin).count() << " ms, RSS "
+                  << rss / 1024 << " KiB, per mission " << static_cast<double>(period.allocations) / count
+                  << " allocations, " << static_cast<double>(period.bytes) / count << " bytes, "
+                  << static_cast<double>(period.live_bytes) / count << " bytes not freed, peak "
+                  << period.peak_live_bytes << " bytes, live in process "
+                  << AllocationCounter::get_totals().live_bytes << " bytes" << std::endl;
+        period = Totals();
+    }
+
+    std::cout << "\nPer query, 99th percentile:" << std::endl;
+    for (const char *robot : {"Wheeled Robot", "Tracked Robot"}) {
+        const QueryMetrics &query = metrics.Get("astar", "action", robot);
+        std::cout << robot << ": " << query.latency.ValueAtQuantile(0.99) << " ns, "
+                  << query.expansions.ValueAtQuantile(0.99) << " expansions, "
+                  << query.allocations.ValueAtQuantile(0.99) << " allocations, "
+                  << query.allocated_bytes.ValueAtQuantile(0.99) << " bytes, peak "
+                  << query.peak_live_bytes.ValueAtQuantile(0.99) << " bytes" << std::endl;
+    }
+    bool is_leaking = false;
+    if (AllocationCounter::kIsEnabled && settled.missions > 0) {
+        const double live = static_cast<double>(settled.live_bytes) / static_cast<double>(settled.missions);
+        std::cout << "Bytes not freed after warm-up: " << live << " per mission" << std::endl;
+        is_leaking = live >= kLiveBytesLimit;
+    }
+    if (samples.size() >= 3) {
+        // Least squares slope of the RSS over the reports, the first one excluded
+        double mean_x = 0, mean_y = 0;
+        for (std::size_t i = 1; i < samples.size(); i++) {
+            mean_x += samples[i].first;
+            mean_y += samples[i].second;
+        }
+        mean_x /= static_cast<double>(samples.size() - 1);
+        mean_y /= static_cast<double>(samples.size() - 1);
+        double covariance = 0, variance = 0;
+        for (std::size_t i = 1; i < samples.size(); i++) {
+            covariance += (samples[i].first - mean_x) * (samples[i].second - mean_y);
+            variance += (samples[i].first - mean_x) * (samples[i].first - mean_x);
+        }
+        const double slope = covariance / variance * 1000;
+        std::cout << "RSS growth after warm-up: " << slope << " bytes per 1000 missions" << std::endl;
+        is_leaking = is_leaking || slope > kRssSlopeLimit;
+    } else {
+        std::cout << "Too few reports after warm-up to measure the RSS growth" << std::endl;
+    }
+    close(null_device);
+    close(terminal);
+    if (is_leaking) {
+        std::cout << "Memory keeps growing, possible leak" << std::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * @file        planner_bench.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file planner_bench.cpp contains a load generator for the planning daemon,
+ *              which reports its throughput and latency percentiles
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Maze.h"
+#include "../include/PlannerServer.h"
+#include "../include/TiledMap.h"
+
+namespace {
+
+/*! \brief Connects to the server, -1 on failure */
+int Connect(const std::string &socket_path) {
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path))
+        return -1;
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*! \brief Reads exactly size bytes, false if the server has gone */
+bool ReadAll(const int &fd, char *data, std::size_t size) {
+    while (size > 0) {
+        const ssize_t received = recv(fd, data, size, 0);
+        if (received <= 0)
+            return false;
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+/*! \brief Picks a random free node of a BitGrid or a TiledMap */
+template <typename Grid>
+std::pair<int, int> RandomFreeNode(const Grid &grid, std::mt19937_64 &random) {
+    std::uniform_int_distribution<int> x(0, grid.get_length() - 1), y(0, grid.get_width() - 1);
+    while (true) {
+        const std::pair<int, int> node(x(random), y(random));
+        if (grid.IsNotObstacle(node))
+            return node;
+    }
+}
+
+/*! \brief Outcome of one client: round trip times in nanoseconds and failures */
+struct ClientResult {
+    std::vector<std::uint64_t> latencies;
+    std::uint64_t no_path = 0;
+    bool is_complete = false;
+};
+
+/*!
+ * \brief Sends requests to random starts and one of a few goals, keeping some of them in
+ * flight, and times each round trip. Replies may come out of order within a batch, so
+ * they are matched by id.
+ * */
+template <typename Grid>
+void RunClient(const std::string &socket_path, const Grid &grid, const std::vector<std::pair<int, int>> &goals,
+               const std::size_t &requests, const std::size_t &in_flight, const std::uint64_t &seed,
+               ClientResult &result) {
+    const int fd = Connect(socket_path);
+    if (fd < 0)
+        return;
+    std::mt19937_64 random(seed);
+    std::uniform_int_distribution<std::size_t> pick_goal(0, goals.size() - 1);
+    std::vector<std::chrono::steady_clock::time_point> sent_at(requests);
+    std::vector<char> body;
+    result.latencies.reserve(requests);
+    std::size_t sent = 0;
+    auto send_next = [&]() {
+        const std::pair<int, int> start = RandomFreeNode(grid, random), goal = goals[pick_goal(random)];
+        PlanRequest request;
+        request.id = static_cast<std::uint32_t>(sent);
+        request.start_x = start.first;
+        request.start_y = start.second;
+        request.goal_x = goal.first;
+        request.goal_y = goal.second;
+        request.mode = kReplyCommands;
+        sent_at[sent++] = std::chrono::steady_clock::now();
+        return send(fd, &request, sizeof(request), MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(request));
+    };
+    bool is_ok = true;
+    while (is_ok && sent < std::min(in_flight, requests))
+        is_ok = send_next();
+    while (is_ok && result.latencies.size() < requests) {
+        PlanReply reply;
+        is_ok = ReadAll(fd, reinterpret_cast<char *>(&reply), sizeof(reply)) && reply.id < requests;
+        if (!is_ok)
+            break;
+        body.resize(reply.count);
+        is_ok = ReadAll(fd, body.data(), body.size());
+        const auto elapsed = std::chrono::steady_clock::now() - sent_at[reply.id];
+        result.latencies.push_back(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        if (reply.status < 0)
+            result.no_path++;
+        if (is_ok && sent < requests)
+            is_ok = send_next();
+    }
+    result.is_complete = is_ok;
+    close(fd);
+}
+
+/*! \brief Value at a quantile of sorted latencies, in microseconds */
+double Percentile(const std::vector<std::uint64_t> &sorted, const double &quantile) {
+    const std::size_t rank = std::min(sorted.size() - 1, static_cast<std::size_t>(quantile * sorted.size()));
+    return static_cast<double>(sorted[rank]) / 1000.0;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <socket path> [tiled map file|-] [clients] [requests per client]"
+                     " [in flight] [goals] [seed]\n"
+                     "The map must be the one served, to pick free starts and goals. The default\n"
+                     "is the maze layout, 4 clients of 10000 requests, 8 in flight, 8 goals." << std::endl;
+        return 1;
+    }
+    // Starts and goals are picked on the tiled map in place, or on the default layout
+    BitGrid grid;
+    TiledMap map;
+    if (argc >= 3 && std::string(argv[2]) != "-") {
+        if (!map.Open(argv[2]))
+            return 1;
+    } else {
+        Maze maze;
+        grid = BitGrid(maze);
+    }
+    const std::size_t clients = argc >= 4 ? std::strtoul(argv[3], nullptr, 10) : 4;
+    const std::size_t requests = argc >= 5 ? std::strtoul(argv[4], nullptr, 10) : 10000;
+    const std::size_t in_flight = argc >= 6 ? std::strtoul(argv[5], nullptr, 10) : 8;
+    const std::size_t goal_count = argc >= 7 ? std::strtoul(argv[6], nullptr, 10) : 8;
+    const std::uint64_t seed = argc >= 8 ? std::strtoull(argv[7], nullptr, 10) : 1;
+    if (clients == 0 || requests == 0 || in_flight == 0 || goal_count == 0) {
+        std::cout << "Clients, requests, in flight and goals must be positive" << std::endl;
+        return 1;
+    }
+    // A few goals reused by every client, as on a warm map
+    std::mt19937_64 random(seed);
+    std::vector<std::pair<int, int>> goals;
+    for (std::size_t i = 0; i < goal_count; i++)
+        goals.push_back(map.is_open() ? RandomFreeNode(map, random) : RandomFreeNode(grid, random));
+    std::vector<ClientResult> results(clients);
+    std::vector<std::thread> threads;
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < clients; i++) {
+        if (map.is_open())
+            threads.emplace_back(RunClient<TiledMap>, std::string(argv[1]), std::cref(map), std::cref(goals),
+                                 requests, in_flight, seed + i + 1, std::ref(results[i]));
+        else
+            threads.emplace_back(RunClient<BitGrid>, std::string(argv[1]), std::cref(grid), std::cref(goals),
+                                 requests, in_flight, seed + i + 1, std::ref(results[i]));
+    }
+    for (auto &thread : threads)
+        thread.join();
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::vector<std::uint64_t> latencies;
+    std::uint64_t no_path = 0;
+    bool is_complete = true;
+    for (const auto &result : results) {
+        latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+        no_path += result.no_path;
+        is_complete = is_complete && result.is_complete;
+    }
+    if (latencies.empty()) {
+        std::cout << "No reply from " << argv[1] << std::endl;
+        return 1;
+    }
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << latencies.size() << " replies in " << seconds << " s: "
+              << static_cast<std::uint64_t>(latencies.size() / seconds) << " requests/s, "
+              << no_path << " without path\n"
+              << "Round trip (us): p50 " << Percentile(latencies, 0.5) << ", p99 " << Percentile(latencies, 0.99)
+              << ", p99.9 " << Percentile(latencies, 0.999) << ", max " << Percentile(latencies, 1.0) << std::endl;
+    if (!is_complete) {
+        std::cout << "Some clients lost the connection" << std::endl;
+        return 1;
+    }
+    return 0;
+}
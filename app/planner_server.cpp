@@ -0,0 +1,93 @@
+/*
+ * @file        planner_server.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file planner_server.cpp contains the entry point of the planning daemon
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <memory>
+#include <string>
+#include "../include/BitGrid.h"
+#include "../include/Maze.h"
+#include "../include/PlannerMetrics.h"
+#include "../include/PlannerServer.h"
+#include "../include/TiledMap.h"
+
+/*! \brief Server to be stopped by SIGINT and SIGTERM */
+static PlannerServer *running_server = nullptr;
+
+/*!
+ * \brief Signal handler asking the server to stop
+ * \param signal_number - received signal
+ * */
+static void HandleSignal(int signal_number) {
+    (void) signal_number;
+    if (running_server != nullptr)
+        running_server->Stop();
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <socket path> [tiled map file|-] [metrics file]\n"
+                     "Without a map file (or with -) the default maze layout is served.\n"
+                     "With a metrics file, Prometheus metrics are written to it every 10 s." << std::endl;
+        return 1;
+    }
+    // A tiled map is served from its mapping, the default layout from a grid
+    BitGrid grid;
+    TiledMap map;
+    std::unique_ptr<PlannerServer> served;
+    if (argc >= 3 && std::string(argv[2]) != "-") {
+        if (!map.Open(argv[2]))
+            return 1;
+        served.reset(new PlannerServer(map));
+    } else {
+        Maze maze;
+        grid = BitGrid(maze);
+        served.reset(new PlannerServer(grid));
+    }
+    PlannerServer &server = *served;
+    if (!server.Listen(argv[1]))
+        return 1;
+    PlannerMetrics metrics;
+    if (argc >= 4) {
+        server.set_metrics(&metrics);
+        metrics.StartPeriodicDump(argv[3], std::chrono::seconds(10));
+    }
+    running_server = &server;
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+    std::cout << "Serving a " << (map.is_open() ? map.get_length() : grid.get_length()) << " x "
+              << (map.is_open() ? map.get_width() : grid.get_width())
+              << " map on " << argv[1] << std::endl;
+    server.Run();
+    running_server = nullptr;
+    metrics.StopPeriodicDump();
+    std::cout << "Answered " << server.get_request_count() << " requests with "
+              << server.get_search_count() << " searches" << std::endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*!
+ * \file        AllocationCounter.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file AllocationCounter.h contains the header declarations for
+ *              AllocationCounter, AllocationScope and CountingAllocator classes. They
+ *              count the memory allocated by the planner and FSM containers.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_ALLOCATIONCOUNTER_H
+#define ENPM809Y_PROJECT_5_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*!
+ * \struct AllocationStats
+ * \brief Define the allocations counted over a period: the number of allocations and
+ * deallocations, the bytes allocated, the bytes allocated and not freed, and the highest
+ * value the latter reached
+ * */
+struct AllocationStats {
+    std::uint64_t allocations = 0;
+    std::uint64_t deallocations = 0;
+    std::uint64_t bytes = 0;
+    std::int64_t live_bytes = 0;
+    std::int64_t peak_live_bytes = 0;
+};
+
+/*!
+ * \class AllocationCounter
+ * \brief The AllocationCounter class holds the counters fed by CountingAllocator and by
+ * the FSM states: one set per thread, which an AllocationScope reads, and one set for
+ * the process, updated atomically. Memory freed by another thread than the one which
+ * allocated it is counted on the thread freeing it.
+ *
+ * The containers only count when the project is configured with
+ * -DMAZE_ENABLE_ALLOCATION_COUNTING=ON; otherwise TrackedAllocator is std::allocator and
+ * every count stays zero.
+ */
+class AllocationCounter {
+public:
+    /*! \brief True if the containers count their allocations */
+#ifdef MAZE_ALLOCATION_COUNTING
+    static const bool kIsEnabled = true;
+#else
+    static const bool kIsEnabled = false;
+#endif
+
+    /*!
+     * \brief Counts an allocation
+     * \param bytes - size allocated
+     * */
+    static void CountAllocation(const std::size_t &bytes);
+
+    /*!
+     * \brief Counts a deallocation
+     * \param bytes - size freed
+     * */
+    static void CountDeallocation(const std::size_t &bytes);
+
+    /*! \brief Gets the counts of the process since it started */
+    static AllocationStats get_totals();
+
+private:
+    friend class AllocationScope;
+
+    /*! \brief Counts of the calling thread since it started */
+    static AllocationStats &Local();
+};
+
+/*!
+ * \class AllocationScope
+ * \brief The AllocationScope class measures the allocations of the calling thread during
+ * its lifetime, e.g. a planning query or a mission. Scopes may be nested, each having its
+ * own peak. A scope is not shared between threads.
+ */
+class AllocationScope {
+public:
+    /*! \brief Constructor starting the measure */
+    AllocationScope();
+
+    /*! \brief Destructor handing the peak back to the enclosing scope */
+    ~AllocationScope();
+
+    AllocationScope(const AllocationScope &) = delete;
+    AllocationScope &operator=(const AllocationScope &) = delete;
+
+    /*! \brief Gets the counts since the scope started; the peak is relative to the live
+     * bytes at the start */
+    AllocationStats get_stats() const;
+
+private:
+    /*! \brief Counts of the thread at the start, and the peak of the enclosing scope */
+    AllocationStats start_;
+    std::int64_t outer_peak_;
+};
+
+/*!
+ * \class CountingAllocator
+ * \brief The CountingAllocator class is std::allocator plus the counts of
+ * AllocationCounter. It is stateless, so containers using it can be swapped and moved
+ * like with std::allocator.
+ */
+template <class T>
+class CountingAllocator {
+public:
+    using value_type = T;
+
+    /*! \brief Default constructor */
+    CountingAllocator() = default;
+
+    /*! \brief Converting constructor, for the node types of the containers */
+    template <class U>
+    CountingAllocator(const CountingAllocator<U> &) {}
+
+    /*!
+     * \brief Allocates storage for some objects
+     * \param count - number of objects
+     * \return the storage
+     * */
+    T *allocate(const std::size_t count) {
+        AllocationCounter::CountAllocation(count * sizeof(T));
+        return std::allocator<T>().allocate(count);
+    }
+
+    /*!
+     * \brief Frees storage
+     * \param pointer - storage returned by allocate
+     * \param count - number of objects it was allocated for
+     * */
+    void deallocate(T *pointer, const std::size_t count) {
+        AllocationCounter::CountDeallocation(count * sizeof(T));
+        std::allocator<T>().deallocate(pointer, count);
+    }
+};
+
+template <class T, class U>
+bool operator==(const CountingAllocator<T> &, const CountingAllocator<U> &) { return true; }
+
+template <class T, class U>
+bool operator!=(const CountingAllocator<T> &, const CountingAllocator<U> &) { return false; }
+
+/*! \brief Allocator of the planner and FSM containers, counting only when enabled */
+#ifdef MAZE_ALLOCATION_COUNTING
+template <class T>
+using TrackedAllocator = CountingAllocator<T>;
+#else
+template <class T>
+using TrackedAllocator = std::allocator<T>;
+#endif
+
+#endif // ENPM809Y_PROJECT_5_ALLOCATIONCOUNTER_H
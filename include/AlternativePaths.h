@@ -0,0 +1,152 @@
+/*!
+ * \file        AlternativePaths.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file AlternativePaths.h contains the header declarations for
+ *              AlternativePaths class. The class finds several routes between two
+ *              nodes in one call, for dispatch to fall back on.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_ALTERNATIVEPATHS_H
+#define ENPM809Y_PROJECT_5_ALTERNATIVEPATHS_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "Path.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \class AlternativePaths
+ * \brief The AlternativePaths class finds the k best routes from a start to a goal.
+ * Both methods first run one BFS backwards from the goal, and every later search is an
+ * A* guided by its distances, which are exact on the map and a lower bound once cells or
+ * moves are taken away or made dearer. That shared tree does most of the work: a search
+ * whose route is not blocked expands little more than the cells of the route.
+ *
+ * FindShortest returns the k shortest simple paths with Yen's algorithm, in Lawler's
+ * form where a path only branches at or after the node where it left its parent. The
+ * branch searches are lazy: a branch first enters the queue of candidates with the lower
+ * bound given by the tree, and is only searched when it comes first, so most of the
+ * branches are never searched at all.
+ *
+ * FindDiverse returns routes which overlap less: after each route its cells get dearer
+ * by a penalty and the next search avoids them as long as the detour is cheaper, until
+ * k different routes are found or the next one is too long compared with the shortest.
+ */
+class AlternativePaths {
+public:
+    /*!
+     * \brief Constructor binding the planner to a map. The grid must outlive the planner.
+     * \param grid - bit-packed free space
+     * */
+    explicit AlternativePaths(const BitGrid &grid) : grid_{grid} {}
+
+    /*! \brief Default destructor */
+    ~AlternativePaths() = default;
+
+    /*!
+     * \brief Finds the k shortest simple paths
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param k - number of paths wanted
+     * \param paths - output, the paths by increasing length
+     * \return number of paths found, fewer than k if there are no more simple paths
+     * */
+    int FindShortest(const std::pair<int, int> &start, const std::pair<int, int> &goal, const int &k,
+                     std::vector<Path> &paths);
+
+    /*!
+     * \brief Finds up to k routes which overlap little
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param k - number of routes wanted
+     * \param paths - output, the shortest path first
+     * \param penalty - cost added to a move into a cell for every route found through it
+     * \param max_stretch - longest route accepted, as a multiple of the shortest
+     * \return number of routes found
+     * */
+    int FindDiverse(const std::pair<int, int> &start, const std::pair<int, int> &goal, const int &k,
+                    std::vector<Path> &paths, const double &penalty = 1.0, const double &max_stretch = 1.5);
+
+    /*! \brief Gets the number of cells expanded by the searches of the last call, the
+     * BFS excluded */
+    std::uint64_t get_expansions() const { return expansions_; }
+
+private:
+    /*!
+     * \struct Candidate
+     * \brief Define a candidate of Yen's algorithm: the branch of an accepted path at one
+     * of its nodes, with either a lower bound of its length or the path found
+     * */
+    struct Candidate {
+        int length;
+        int path;
+        int spur;
+        bool is_searched;
+        std::vector<int> cells;
+    };
+
+    /*! \brief Runs the BFS from the goal, false if the start cannot reach it */
+    bool Prepare(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Marks the cells and moves a branch may not use
+     * \param path - accepted path branching
+     * \param spur - index of the node where the branch leaves it
+     * */
+    void Restrict(const int &path, const int &spur);
+
+    /*!
+     * \brief Lower bound of the length of a branch, Restrict called
+     * \return length, -1 if the branch cannot leave the node
+     * */
+    int Bound(const int &path, const int &spur) const;
+
+    /*!
+     * \brief Searches from a cell to the goal with A*, avoiding the restricted cells and
+     * moves, with every move into a cell costing one plus its penalty
+     * \param from - first cell
+     * \param cells - output, cells from the first one to the goal
+     * \return true if the goal was reached, false if else
+     * */
+    bool Search(const int &from, std::vector<int> &cells);
+
+    /*! \brief Converts cells to a path */
+    void ToPath(const std::vector<int> &cells, Path &path) const;
+
+    /*! \brief Map being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Goal cell and moves from every cell to it, -1 if it cannot be reached */
+    int goal_ = -1;
+    std::vector<int> to_goal_;
+
+    /*! \brief Cells a branch may not enter and cells it may not move to from its first
+     * cell, current when their stamp is the epoch */
+    std::vector<std::uint32_t> blocked_;
+    std::vector<int> forbidden_;
+    std::uint32_t epoch_ = 0;
+
+    /*! \brief Penalty of every cell for FindDiverse, and the cells with one */
+    std::vector<double> penalty_;
+    std::vector<int> penalized_;
+
+    /*! \brief Accepted paths, the node where each left its parent, and the candidates */
+    std::vector<std::vector<int>> accepted_;
+    std::vector<int> deviation_;
+    std::vector<Candidate> candidates_;
+
+    /*! \brief Open list, costs and parents of the searches */
+    SearchWorkspace workspace_;
+
+    /*! \brief Cells expanded by the last call */
+    std::uint64_t expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_ALTERNATIVEPATHS_H
@@ -0,0 +1,132 @@
+/*!
+ * \file        AnytimePlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file AnytimePlanner.h contains the header declarations for
+ *              AnytimePlanner class. The class implements Anytime Repairing A*
+ *              (ARA*) which improves its path until a deadline.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_ANYTIMEPLANNER_H
+#define ENPM809Y_PROJECT_5_ANYTIMEPLANNER_H
+
+#include <chrono>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \struct AnytimeResult
+ * \brief Define data structure for the outcome of an anytime query: the best path
+ * found, its cost, the suboptimality bound proven for it (the path costs at most
+ * bound times the optimal cost), the number of completed iterations and the number
+ * of expanded nodes
+ * */
+struct AnytimeResult {
+    std::vector<std::pair<int, int>> path;
+    double cost = -1;
+    double bound = -1;
+    int iterations = 0;
+    std::size_t expansions = 0;
+};
+
+/*!
+ * \class AnytimePlanner
+ * \brief The AnytimePlanner class runs a weighted A* with inflation factor epsilon
+ * (priority g + epsilon * h), which quickly finds a path at most epsilon times longer
+ * than the optimal one. While time remains, epsilon is decreased and the search is
+ * repaired rather than restarted: costs and parents are kept, and only the nodes whose
+ * cost improved after their expansion (the inconsistent nodes) are put back into the
+ * open list. Every completed iteration publishes its path together with the bound
+ * min(epsilon, g(goal) / min(g + h) over open and inconsistent nodes).
+ */
+class AnytimePlanner {
+public:
+    /*! \brief Clock used for deadlines */
+    typedef std::chrono::steady_clock Clock;
+
+    /*!
+     * \brief Constructor binding the planner to a grid. The grid must outlive the planner.
+     * \param grid - bit-packed free space
+     * \param initial_epsilon - inflation factor of the first iteration
+     * \param epsilon_step - decrease of the inflation factor between iterations
+     * */
+    explicit AnytimePlanner(const BitGrid &grid, const double &initial_epsilon = 3.0,
+                            const double &epsilon_step = 0.5);
+
+    /*! \brief Default destructor */
+    ~AnytimePlanner() = default;
+
+    /*!
+     * \brief Plans until the path is proven optimal or the deadline passes
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param deadline - time at which the best path so far is returned
+     * \param result - output, best path and its bound
+     * \return 1 if a path was found, -1 if no path exists or none was found in time
+     * */
+    int Plan(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+             const Clock::time_point &deadline, AnytimeResult &result);
+
+    /*!
+     * \brief Plans within a time budget counted from now
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param budget - time budget, e.g. 20 ms for one dispatch round
+     * \param result - output, best path and its bound
+     * \return 1 if a path was found, -1 if no path exists or none was found in time
+     * */
+    int Plan(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+             const std::chrono::microseconds &budget, AnytimeResult &result);
+
+private:
+    /*! \brief Admissible heuristic, Manhattan distance to the goal */
+    double Heuristic(const int &state) const;
+
+    /*!
+     * \brief Expands nodes until no open node can improve the goal for the current epsilon
+     * \param deadline - time at which the iteration is abandoned
+     * \return false if the deadline passed before the iteration completed
+     * */
+    bool ImprovePath(const Clock::time_point &deadline);
+
+    /*!
+     * \brief Moves the open and inconsistent nodes into rebuild_ and computes the
+     * smallest g + h among them
+     * \return smallest g + h, infinity if there is no such node
+     * */
+    double CollectFrontier();
+
+    /*! \brief Grid being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Inflation schedule */
+    double initial_epsilon_, epsilon_step_;
+
+    /*! \brief Current inflation factor */
+    double epsilon_ = 1;
+
+    /*! \brief Goal of the current query */
+    std::pair<int, int> goal_{-1, -1};
+    int goal_state_ = -1;
+
+    /*! \brief Workspace of the current query */
+    SearchWorkspace *workspace_ = nullptr;
+
+    /*! \brief Nodes whose cost improved after they were expanded */
+    std::vector<int> inconsistent_;
+
+    /*! \brief Nodes to be pushed again with the next epsilon */
+    std::vector<int> rebuild_;
+
+    /*! \brief Expansions of the current query */
+    std::size_t expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_ANYTIMEPLANNER_H
@@ -0,0 +1,137 @@
+/*!
+ * \file        BitGrid.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file BitGrid.h contains the header declarations for BitGrid
+ *              class. The class stores the free space of a maze as a bit-packed
+ *              mask which is shared by the grid based planners.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_BITGRID_H
+#define ENPM809Y_PROJECT_5_BITGRID_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Maze.h"
+
+/*!
+ * \class BitGrid
+ * \brief The BitGrid class keeps one bit per cell of the maze, set when the cell
+ * is free. Every row is padded to a whole number of 64 bit words so that a row
+ * can be processed word by word. Bits beyond the length of the maze are always
+ * zero, hence they behave like walls.
+ */
+class BitGrid {
+public:
+    /*! \brief Steps in x and y of the four moves, in the order Maze::Search tries them:
+     * North (y - 1), South (y + 1), East (x + 1) and West (x - 1) */
+    static const int kMoveX[4];
+    static const int kMoveY[4];
+
+    /*! \brief Default constructor for an empty grid */
+    BitGrid() = default;
+
+    /*!
+     * \brief Constructor for a grid of given size with every cell blocked
+     * \param length - number of columns (x direction)
+     * \param width - number of rows (y direction)
+     * */
+    BitGrid(const int &length, const int &width);
+
+    /*!
+     * \brief Constructor copying the free space of a Maze
+     * \param maze - maze whose IsNotObstacle cells become free bits
+     * */
+    explicit BitGrid(const Maze &maze);
+
+    /*! \brief Default destructor */
+    ~BitGrid() = default;
+
+    /*!
+     * \brief Checks if given node is not an obstacle
+     * \param node - coordinate of node to be checked
+     * \return false if the node is a wall, true if else
+     * */
+    bool IsNotObstacle(const std::pair<int, int> &node) const {
+        return ((bits_[static_cast<std::size_t>(node.second) * words_per_row_ + (node.first >> 6)]
+                >> (node.first & 63)) & 1u) != 0;
+    }
+
+    /*!
+     * \brief Checks if given node is within the grid
+     * \param node - coordinate of node to be checked
+     * \return true if the node is within the grid, false if else
+     * */
+    bool IsWithinRegion(const std::pair<int, int> &node) const {
+        return node.first >= 0 && node.first < length_ &&
+               node.second >= 0 && node.second < width_;
+    }
+
+    /*!
+     * \brief Marks the cell at (x,y) as free or blocked
+     * \param x - x coordinate of node
+     * \param y - y coordinate of node
+     * \param is_free - true to clear the obstacle, false to set it
+     * */
+    void SetFree(const int &x, const int &y, const bool &is_free);
+
+    /*!
+     * \brief Converts a node to its row-major cell index
+     * \param node - coordinate of node
+     * \return cell index y * length + x
+     * */
+    int ToIndex(const std::pair<int, int> &node) const {
+        return node.second * length_ + node.first;
+    }
+
+    /*!
+     * \brief Converts a row-major cell index back to a node
+     * \param index - cell index
+     * \return coordinate of node
+     * */
+    std::pair<int, int> ToNode(const int &index) const {
+        return std::make_pair(index % length_, index / length_);
+    }
+
+    /*! \brief Pointer to the first word of row y */
+    const std::uint64_t *Row(const int &y) const {
+        return bits_.data() + static_cast<std::size_t>(y) * words_per_row_;
+    }
+
+    /*! \brief Mutable pointer to the first word of row y */
+    std::uint64_t *Row(const int &y) {
+        return bits_.data() + static_cast<std::size_t>(y) * words_per_row_;
+    }
+
+    /*! \brief Gets the length (number of columns) of the grid */
+    int get_length() const { return length_; }
+
+    /*! \brief Gets the width (number of rows) of the grid */
+    int get_width() const { return width_; }
+
+    /*! \brief Gets the number of 64 bit words in each row */
+    int get_words_per_row() const { return words_per_row_; }
+
+    /*! \brief Gets the total number of cells */
+    int get_cell_count() const { return length_ * width_; }
+
+private:
+    /*! \brief Number of columns */
+    int length_ = 0;
+
+    /*! \brief Number of rows */
+    int width_ = 0;
+
+    /*! \brief Number of 64 bit words in each row */
+    int words_per_row_ = 0;
+
+    /*! \brief Bit-packed free space mask, row-major */
+    std::vector<std::uint64_t> bits_;
+};
+
+#endif // ENPM809Y_PROJECT_5_BITGRID_H
@@ -0,0 +1,83 @@
+/*!
+ * \file        BucketQueue.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file BucketQueue.h contains the header declarations for
+ *              BucketQueue class. The class is an open list for searches whose
+ *              priorities are small integers.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_BUCKETQUEUE_H
+#define ENPM809Y_PROJECT_5_BUCKETQUEUE_H
+
+#include <cstddef>
+#include <vector>
+
+/*!
+ * \class BucketQueue
+ * \brief The BucketQueue class is the open list of Dial's algorithm: one bucket of states
+ * per integer priority, kept in a ring. A search whose step costs are integers up to C,
+ * with a consistent heuristic, only pushes priorities between the current minimum and
+ * the minimum plus 2C, so a ring of 2C + 1 buckets covers every live priority. Push is
+ * an append to a bucket and Pop takes from the current bucket, moving forward over at
+ * most 2C empty buckets, so both are O(1) and no comparison is made. Within a bucket the
+ * last state pushed pops first, which favours the deepest of the tied nodes like the
+ * tie break of A*. The buckets keep their storage between queries.
+ */
+class BucketQueue {
+public:
+    /*! \brief Default constructor for an empty queue */
+    BucketQueue() = default;
+
+    /*! \brief Default destructor */
+    ~BucketQueue() = default;
+
+    /*!
+     * \brief Empties the queue for a new query
+     * \param span - largest difference between a pushed priority and the current minimum
+     * */
+    void Reset(const int &span);
+
+    /*!
+     * \brief Pushes a state into the queue
+     * \param priority - non-negative priority, between the current minimum and the minimum
+     * plus the span; the first push after Reset sets the minimum
+     * \param state - state index
+     * */
+    void Push(const int &priority, const int &state) {
+        if (current_ < 0)
+            current_ = priority;
+        buckets_[static_cast<std::size_t>(priority) & mask_].push_back(state);
+        size_++;
+    }
+
+    /*!
+     * \brief Removes a state with the lowest priority
+     * \param priority - output, priority of the state
+     * \return the removed state, the queue must not be empty
+     * */
+    int Pop(int &priority);
+
+    /*! \brief Checks if the queue is empty */
+    bool IsEmpty() const { return size_ == 0; }
+
+    /*! \brief Gets the number of states in the queue */
+    std::size_t get_size() const { return size_; }
+
+private:
+    /*! \brief Ring of buckets, its size is a power of two */
+    std::vector<std::vector<int>> buckets_;
+    std::size_t mask_ = 0;
+
+    /*! \brief Priority of the current bucket, -1 before the first push */
+    int current_ = -1;
+
+    /*! \brief Number of states in the queue */
+    std::size_t size_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_BUCKETQUEUE_H
@@ -0,0 +1,182 @@
+/*!
+ * \file        CommandRing.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file CommandRing.h contains the header declarations for CommandRing
+ *              and CommandExecutor classes. They stream the moves of a path from the
+ *              planner to a robot while the path is still being built.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_COMMANDRING_H
+#define ENPM809Y_PROJECT_5_COMMANDRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "MobileRobot.h"
+
+/*!
+ * \class CommandRing
+ * \brief The CommandRing class is a lock-free ring buffer of move commands between one
+ * producer thread, the planner, and one consumer thread, the executor. Commands are the
+ * move codes of PathView. The producer only writes the tail and the consumer only the
+ * head, each on its own cache line, and each side keeps a copy of the other index so it
+ * reads the shared one only when the ring looks full or empty.
+ *
+ * Push waits while the ring is full, which holds the planner back to the pace of the
+ * robot, and Pop waits while it is empty until the producer closes the stream. Waiting
+ * spins a little, then yields the processor.
+ */
+class CommandRing {
+public:
+    /*! \brief Default number of commands the ring holds */
+    static const std::size_t kDefaultCapacity = 256;
+
+    /*!
+     * \brief Constructor for an empty, open ring
+     * \param capacity - number of commands held, rounded up to a power of two
+     * */
+    explicit CommandRing(const std::size_t &capacity = kDefaultCapacity);
+
+    /*! \brief Default destructor */
+    ~CommandRing() = default;
+
+    CommandRing(const CommandRing &) = delete;
+    CommandRing &operator=(const CommandRing &) = delete;
+
+    /*!
+     * \brief Adds a command if there is room, producer only
+     * \param command - move code
+     * \return true if the command was added, false if the ring is full
+     * */
+    bool TryPush(const std::uint8_t &command) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == slots_.size()) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == slots_.size())
+                return false;
+        }
+        slots_[tail & mask_] = command;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief Adds a command, waiting while the ring is full, producer only
+     * \param command - move code
+     * */
+    void Push(const std::uint8_t &command);
+
+    /*! \brief Ends the stream once the commands pushed are drained, producer only */
+    void Close() { is_closed_.store(true, std::memory_order_release); }
+
+    /*!
+     * \brief Takes the oldest command if there is one, consumer only
+     * \param command - output, move code
+     * \return true if a command was taken, false if the ring is empty
+     * */
+    bool TryPop(std::uint8_t &command) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+                return false;
+        }
+        command = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /*!
+     * \brief Takes the oldest command, waiting while the ring is empty, consumer only
+     * \param command - output, move code
+     * \return true if a command was taken, false if the stream is closed and drained
+     * */
+    bool Pop(std::uint8_t &command);
+
+    /*! \brief Empties and reopens the ring, while neither side uses it */
+    void Reset();
+
+    /*! \brief Gets the number of commands the ring holds */
+    std::size_t get_capacity() const { return slots_.size(); }
+
+    /*! \brief Gets the number of times Push found the ring full */
+    std::uint64_t get_full_waits() const { return full_waits_.load(std::memory_order_relaxed); }
+
+private:
+    /*! \brief Commands, a power of two of them, and the mask of an index */
+    std::vector<std::uint8_t> slots_;
+    std::size_t mask_;
+
+    /*! \brief Set by the producer at the end of the stream */
+    std::atomic<bool> is_closed_{false};
+
+    /*! \brief Next command to take, written by the consumer, and its copy of the tail */
+    char head_padding_[64];
+    std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+
+    /*! \brief Next slot to fill, written by the producer, its copy of the head, and the
+     * number of waits */
+    char tail_padding_[64];
+    std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+    std::atomic<std::uint64_t> full_waits_{0};
+    char end_padding_[64];
+};
+
+/*!
+ * \class CommandExecutor
+ * \brief The CommandExecutor class is the consumer of a CommandRing: a thread which
+ * takes the commands as they arrive and runs them through the state machine of the robot
+ * with MobileRobot::Execute, as "UP", "DOWN", "LEFT" or "RIGHT", until the stream is
+ * closed. The plan stack of the robot is left as it was.
+ */
+class CommandExecutor {
+public:
+    /*!
+     * \brief Constructor binding the executor to a ring. The ring must outlive it.
+     * \param ring - ring to drain
+     * */
+    explicit CommandExecutor(CommandRing &ring) : ring_{ring} {}
+
+    /*! \brief Destructor waiting for the thread */
+    ~CommandExecutor();
+
+    CommandExecutor(const CommandExecutor &) = delete;
+    CommandExecutor &operator=(const CommandExecutor &) = delete;
+
+    /*!
+     * \brief Starts draining the ring into a robot, after the previous stream has ended
+     * \param robot - robot receiving the moves
+     * */
+    void Start(const std::shared_ptr<MobileRobot> &robot);
+
+    /*!
+     * \brief Waits until the stream is closed and every command is executed
+     * \return number of commands executed by the last stream
+     * */
+    std::size_t Join();
+
+    /*! \brief Gets the number of commands executed so far by the current stream */
+    std::size_t get_executed() const { return executed_.load(std::memory_order_acquire); }
+
+private:
+    /*! \brief Ring drained */
+    CommandRing &ring_;
+
+    /*! \brief Thread of the current stream */
+    std::thread thread_;
+
+    /*! \brief Commands executed by the current stream */
+    std::atomic<std::size_t> executed_{0};
+};
+
+#endif // ENPM809Y_PROJECT_5_COMMANDRING_H
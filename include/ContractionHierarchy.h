@@ -0,0 +1,204 @@
+/*!
+ * \file        ContractionHierarchy.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file ContractionHierarchy.h contains the header declarations for
+ *              ContractionHierarchy class. The class preprocesses a static map so
+ *              that shortest paths are found by tiny bidirectional searches.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_CONTRACTIONHIERARCHY_H
+#define ENPM809Y_PROJECT_5_CONTRACTIONHIERARCHY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "Path.h"
+
+/*!
+ * \struct ContractionHeader
+ * \brief Define the header stored at the start of a contraction hierarchy file. It is
+ * followed by the cell of every node and the first arc of every node (plus one end
+ * marker) as 32 bit words, and by the arcs.
+ * */
+struct ContractionHeader {
+    char magic[4] = {'M', 'Z', 'C', 'H'};
+    std::uint32_t version = 1;
+    std::uint32_t length = 0;
+    std::uint32_t width = 0;
+    std::uint32_t node_count = 0;
+    std::uint32_t arc_count = 0;
+};
+
+/*!
+ * \struct HierarchyArc
+ * \brief Define an arc from a node to a more important node: the target, the length of
+ * the path it stands for and, for a shortcut, the node it bypasses (-1 for a move)
+ * */
+struct HierarchyArc {
+    std::int32_t target = -1;
+    std::int32_t weight = 0;
+    std::int32_t middle = -1;
+};
+
+/*!
+ * \struct SearchLabel
+ * \brief Define the state of a node in one direction of a query: the stamp of the query
+ * which reached it, its distance and its parent node
+ * */
+struct SearchLabel {
+    std::uint32_t stamp = 0;
+    int distance = 0;
+    int parent = -1;
+};
+
+/*!
+ * \class ContractionHierarchy
+ * \brief The ContractionHierarchy class builds a contraction hierarchy over the graph of
+ * the free cells and their North, East, West and South neighbours. Nodes are contracted
+ * from the least to the most important: a contracted node is removed from the graph and
+ * its neighbours are joined by a shortcut unless a witness search finds a path at least
+ * as short without it. The order is computed in rounds: every node which is more
+ * contractible than all its neighbours is contracted in the same round, by all threads,
+ * and witness searches do not cross the nodes of the round, so that the contractions do
+ * not depend on each other. Contractibility is estimated with witnesses of a single arc,
+ * cheap enough to redo for every neighbour of every contracted node, while the
+ * contraction runs full witness searches. Each node keeps its arcs towards more
+ * important nodes.
+ *
+ * A query runs A* upwards from the start and from the goal, skipping the nodes which are
+ * reached more cheaply from above (stall on demand), and stops when neither search can
+ * improve the best meeting node. The estimate of the rest of the path is the larger of
+ * the Manhattan distance to the other end and the bounds given by the distances of both
+ * ends to a few landmarks, picked far apart on the map when it is built or loaded. In open
+ * rooms and aisles most nodes lie on a shortest path, and in mazes the landmarks follow
+ * the corridors, so the searches meet after a few tens of nodes. A path which has to go
+ * around a long wall still settles most of the nodes above its ends. The shortcuts of
+ * the path found are then unpacked into moves through the nodes they bypass, which takes
+ * time linear in the length of the path.
+ */
+class ContractionHierarchy {
+public:
+    /*! \brief Default constructor for an empty hierarchy */
+    ContractionHierarchy() = default;
+
+    /*! \brief Default destructor */
+    ~ContractionHierarchy() = default;
+
+    /*!
+     * \brief Contracts every free cell of a map
+     * \param grid - bit-packed free space
+     * \param threads - number of threads, 0 for one per hardware thread
+     * \return number of shortcuts added
+     * */
+    std::size_t Build(const BitGrid &grid, const int &threads = 0);
+
+    /*!
+     * \brief Writes the hierarchy to a binary file
+     * \param path - file name
+     * \return true if the file was written, false if else
+     * */
+    bool Save(const std::string &path) const;
+
+    /*!
+     * \brief Reads a hierarchy from a binary file and checks that it matches the map
+     * \param path - file name
+     * \param grid - map the hierarchy must have been built for
+     * \return true if the hierarchy was loaded, false if else
+     * */
+    bool Load(const std::string &path, const BitGrid &grid);
+
+    /*!
+     * \brief Length of a shortest path, without unpacking it
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \return number of moves, -1 if no path exists
+     * */
+    int Distance(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Finds a shortest path
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, cleared if no path exists
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path);
+
+    /*! \brief Gets the number of nodes, the free cells */
+    std::size_t get_node_count() const { return cells_.size(); }
+
+    /*! \brief Gets the number of upward arcs, moves and shortcuts */
+    std::size_t get_arc_count() const { return arcs_.size(); }
+
+    /*! \brief Gets the number of nodes settled by the last query */
+    int get_settled() const { return settled_; }
+
+    /*! \brief Gets the size of the hierarchy in bytes */
+    std::size_t get_bytes() const;
+
+private:
+    /*!
+     * \brief Runs the bidirectional upward search
+     * \param from - start node
+     * \param to - goal node
+     * \return length of the shortest path, -1 if no path exists
+     * */
+    int Search(const int &from, const int &to);
+
+    /*!
+     * \brief Appends the cells of the path an arc stands for, without its first cell
+     * \param from - node the path leaves
+     * \param to - node the path reaches, joined to from by an arc
+     * */
+    void AppendArc(const int &from, const int &to);
+
+    /*! \brief Picks the landmarks and computes their distances to every node */
+    void PlaceLandmarks();
+
+    /*! \brief Arc between two nodes, held by the less important one */
+    const HierarchyArc &FindArc(const int &a, const int &b) const;
+
+    /*! \brief Node of a coordinate, -1 for a wall or a node outside the map */
+    int NodeOf(const std::pair<int, int> &node) const;
+
+    /*! \brief Size of the map */
+    int length_ = 0, width_ = 0;
+
+    /*! \brief Cell of every node and node of every cell (-1 for walls). Nodes are
+     * numbered in contraction order, so an arc always goes to a larger node. */
+    std::vector<std::uint32_t> cells_;
+    std::vector<int> nodes_;
+
+    /*! \brief First upward arc of every node, plus an end marker, and the arcs, sorted by
+     * target for every node */
+    std::vector<std::uint32_t> first_arc_;
+    std::vector<HierarchyArc> arcs_;
+
+    /*! \brief Coordinate of every node, for the estimates of a query */
+    std::vector<std::pair<int, int>> coordinates_;
+
+    /*! \brief Distance from every landmark to every node, the landmarks of a node side by side */
+    std::vector<int> landmark_distances_;
+
+    /*! \brief Scratch of a query, per direction: label of every node, and the queue */
+    std::vector<SearchLabel> labels_[2];
+    std::vector<std::pair<int, int>> queue_[2];
+    std::uint32_t epoch_ = 0;
+
+    /*! \brief Scratch of an unpacking */
+    std::vector<std::pair<int, int>> nodes_on_path_;
+    std::vector<std::pair<int, int>> unpack_stack_;
+
+    /*! \brief Meeting node and settled count of the last query */
+    int meeting_ = -1, settled_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_CONTRACTIONHIERARCHY_H
@@ -0,0 +1,207 @@
+/*!
+ * \file        CorridorGraph.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file CorridorGraph.h contains the header declarations for
+ *              CorridorGraph class. The class contracts the corridors of a maze into
+ *              a small weighted graph of junctions and dead ends.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_CORRIDORGRAPH_H
+#define ENPM809Y_PROJECT_5_CORRIDORGRAPH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "Path.h"
+
+/*!
+ * \struct CorridorLattice
+ * \brief Define the lattice of corridor blocks of a maze, along x and along y: the
+ * distance between the first cells of two neighbouring blocks, the size of a block (at
+ * most the pitch, the rest being wall or opening) and the first cell of the first block.
+ * The defaults fit the built-in maze, whose columns are two cells wide on a three cell
+ * pitch and whose rows are one cell high on a two cell pitch.
+ * */
+struct CorridorLattice {
+    int pitch_x = 3;
+    int width_x = 2;
+    int offset_x = 1;
+    int pitch_y = 2;
+    int width_y = 1;
+    int offset_y = 1;
+};
+
+/*!
+ * \struct CorridorEdge
+ * \brief Define a contracted corridor: its two end vertices, the direction in which it
+ * leaves each of them (a kMove value), its length in blocks and its cost in cells
+ * */
+struct CorridorEdge {
+    int a = -1;
+    int b = -1;
+    std::uint8_t direction_a = 0;
+    std::uint8_t direction_b = 0;
+    int length = 0;
+    int cost = 0;
+};
+
+/*!
+ * \class CorridorGraph
+ * \brief The CorridorGraph class sees a maze as a lattice of rectangular blocks of
+ * corridor (see CorridorLattice) separated by walls which are either solid or open
+ * between two blocks. Blocks with two openings are corridor, the others
+ * are junctions and dead ends, and every chain of corridor blocks between two of them
+ * becomes one weighted edge, so the graph has a small fraction of the cells of the map.
+ *
+ * A query attaches the start and goal blocks to the ends of their corridors, runs A*
+ * over the graph, and walks the edges found to list the blocks of the route. The cells
+ * of those blocks and of the openings between them are then searched breadth first,
+ * which is linear in the length of the route, to give the path in cells. The route is
+ * shortest in blocks, and the path shortest among the paths through the route; it can be
+ * a few cells longer than the shortest path of the map when the start or the goal is in
+ * an opening, or because of the lane changes inside wide corridors.
+ */
+class CorridorGraph {
+public:
+    /*! \brief Direction codes, the same as the robot commands */
+    static const int kMoveUp = 0;
+    static const int kMoveDown = 1;
+    static const int kMoveLeft = 2;
+    static const int kMoveRight = 3;
+
+    /*!
+     * \brief Constructor binding the graph to a grid. The grid must outlive the graph.
+     * \param grid - bit-packed free space
+     * */
+    explicit CorridorGraph(const BitGrid &grid);
+
+    /*! \brief Default destructor */
+    ~CorridorGraph() = default;
+
+    /*!
+     * \brief Finds the blocks and contracts the corridors. Fails if a block or an
+     * opening is partly blocked. Cells outside the blocks and openings, like the entrance
+     * in the border of the built-in maze, are ignored and cannot be a start or a goal.
+     * \param lattice - size and position of the blocks
+     * \return true if the map fits the lattice, false if else
+     * */
+    bool Build(const CorridorLattice &lattice = CorridorLattice());
+
+    /*!
+     * \brief Finds a path through the graph and expands it to cells
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, cleared if no path exists
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path);
+
+    /*! \brief Gets the number of junctions and dead ends */
+    std::size_t get_vertex_count() const { return vertex_block_.size(); }
+
+    /*! \brief Gets the number of contracted corridors */
+    std::size_t get_edge_count() const { return edges_.size(); }
+
+    /*! \brief Gets the number of free blocks */
+    std::size_t get_block_count() const { return free_blocks_; }
+
+    /*! \brief Gets the number of graph states expanded by the last query */
+    int get_expansions() const { return expansions_; }
+
+    /*! \brief Gets the number of cells searched to expand the last route */
+    int get_expanded_cells() const { return expanded_cells_; }
+
+private:
+    /*!
+     * \brief Block holding a cell
+     * \param node - coordinate of node
+     * \param next - output, the block after the opening holding the node, -1 if the
+     * node is in a block
+     * \return the block holding the node or the block before its opening, -1 if none
+     * */
+    int BlockOf(const std::pair<int, int> &node, int &next) const;
+
+    /*! \brief Neighbouring block in a direction */
+    int Neighbour(const int &block, const int &direction) const;
+
+    /*! \brief Cost in cells of a step between blocks in a direction */
+    int StepCost(const int &direction) const {
+        return direction < 2 ? lattice_.pitch_y : lattice_.pitch_x;
+    }
+
+    /*! \brief Direction leaving a corridor block which was entered in a direction */
+    int Continue(const int &block, const int &direction) const;
+
+    /*!
+     * \brief Lists the blocks met walking from a block along the corridors
+     * \param block - first block, not listed
+     * \param direction - direction of the first step
+     * \param steps - number of blocks to list
+     * \param blocks - output, cleared first
+     * */
+    void Walk(const int &block, const int &direction, const int &steps, std::vector<int> &blocks) const;
+
+    /*! \brief Contracts the corridors leaving a vertex */
+    void AddEdges(const int &vertex);
+
+    /*! \brief Allows the cells of a block, or of the opening between two neighbouring blocks */
+    void Allow(const int &block);
+    void AllowOpening(const int &block, const int &next);
+
+    /*! \brief Allows a rectangle of cells */
+    void AllowCells(const int &x0, const int &y0, const int &x1, const int &y1);
+
+    /*!
+     * \brief Appends to the route the blocks of a corridor between two positions
+     * \param edge - corridor
+     * \param from - position of the last block of the route, 0 for the end a and the
+     * length for the end b
+     * \param to - position of the block to go to
+     * */
+    void AppendSegment(const int &edge, const int &from, const int &to);
+
+    /*! \brief Grid being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Lattice and number of blocks per row and column */
+    CorridorLattice lattice_;
+    int blocks_x_ = 0, blocks_y_ = 0;
+    std::size_t free_blocks_ = 0;
+
+    /*! \brief Openings of every block, one bit per direction, and 0x10 for a free block */
+    std::vector<std::uint8_t> links_;
+
+    /*! \brief Vertex of every block, -1 for corridor and blocked blocks */
+    std::vector<int> block_vertex_;
+
+    /*! \brief Corridor of every corridor block, and its distance from the end a in
+     * blocks and in cells */
+    std::vector<int> block_edge_, block_step_, block_cost_;
+
+    /*! \brief Block of every vertex */
+    std::vector<int> vertex_block_;
+
+    /*! \brief Contracted corridors, and for every vertex its first incidence (plus an end
+     * marker) in the incidence list of (neighbour vertex, edge * 2 + 1 if left by the end b) */
+    std::vector<CorridorEdge> edges_;
+    std::vector<int> first_incidence_;
+    std::vector<std::pair<int, int>> incidences_;
+
+    /*! \brief Scratch of a query: edge used to reach every state with the positions it
+     * was taken between, route of blocks, walks, allowed cell stamps and breadth first queue */
+    std::vector<int> via_edge_, via_from_, via_to_, route_, walk_, queue_;
+    std::vector<std::uint32_t> allowed_;
+    std::uint32_t epoch_ = 0;
+
+    /*! \brief Statistics of the last query */
+    int expansions_ = 0, expanded_cells_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_CORRIDORGRAPH_H
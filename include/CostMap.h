@@ -0,0 +1,107 @@
+/*!
+ * \file        CostMap.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file CostMap.h contains the header declarations for CostMap
+ *              class. The class stores the terrain of every cell of a map, alongside
+ *              the free space of a BitGrid.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_COSTMAP_H
+#define ENPM809Y_PROJECT_5_COSTMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/*!
+ * \class CostMap
+ * \brief The CostMap class keeps one byte per cell, row-major like BitGrid, holding the
+ * terrain class of the cell. The class says what the floor is, not what it costs: each
+ * robot type turns a class into a cost with MobileRobot::get_terrain_cost, so the same
+ * map serves every robot. Walls stay in the BitGrid; the terrain of a wall is ignored.
+ */
+class CostMap {
+public:
+    /*! \brief Terrain classes */
+    static const std::uint8_t kFloor = 0;
+    static const std::uint8_t kRamp = 1;
+    static const std::uint8_t kSlow = 2;
+    static const std::uint8_t kNoStop = 3;
+    static const std::uint8_t kRough = 4;
+
+    /*! \brief Default constructor for an empty map */
+    CostMap() = default;
+
+    /*!
+     * \brief Constructor for a map of given size with every cell on floor
+     * \param length - number of columns (x direction)
+     * \param width - number of rows (y direction)
+     * */
+    CostMap(const int &length, const int &width);
+
+    /*! \brief Default destructor */
+    ~CostMap() = default;
+
+    /*!
+     * \brief Retrieves the terrain class of a cell
+     * \param node - coordinate of node, must be within the map
+     * \return terrain class
+     * */
+    std::uint8_t get_terrain(const std::pair<int, int> &node) const {
+        return terrain_[static_cast<std::size_t>(node.second) * length_ + node.first];
+    }
+
+    /*!
+     * \brief Retrieves the terrain class of a cell by its index
+     * \param index - cell index y * length + x
+     * \return terrain class
+     * */
+    std::uint8_t get_terrain(const int &index) const { return terrain_[index]; }
+
+    /*!
+     * \brief Sets the terrain class of the cell at (x,y)
+     * \param x - x coordinate of node
+     * \param y - y coordinate of node
+     * \param terrain - terrain class
+     * */
+    void SetTerrain(const int &x, const int &y, const std::uint8_t &terrain);
+
+    /*!
+     * \brief Sets the terrain class of a rectangle, clipped to the map
+     * \param first - coordinate of one corner
+     * \param last - coordinate of the opposite corner, included
+     * \param terrain - terrain class
+     * */
+    void Fill(const std::pair<int, int> &first, const std::pair<int, int> &last, const std::uint8_t &terrain);
+
+    /*!
+     * \brief Checks if a robot may stop on a terrain class, e.g. to end a path
+     * \param terrain - terrain class
+     * \return false for kNoStop, true if else
+     * */
+    static bool IsStopAllowed(const std::uint8_t &terrain) { return terrain != kNoStop; }
+
+    /*! \brief Gets the length (number of columns) of the map */
+    int get_length() const { return length_; }
+
+    /*! \brief Gets the width (number of rows) of the map */
+    int get_width() const { return width_; }
+
+private:
+    /*! \brief Number of columns */
+    int length_ = 0;
+
+    /*! \brief Number of rows */
+    int width_ = 0;
+
+    /*! \brief Terrain class of every cell, row-major */
+    std::vector<std::uint8_t> terrain_;
+};
+
+#endif // ENPM809Y_PROJECT_5_COSTMAP_H
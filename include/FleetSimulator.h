@@ -0,0 +1,137 @@
+/*!
+ * \file        FleetSimulator.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file FleetSimulator.h contains the header declarations for
+ *              FleetSimulator class. The class executes the planned commands of many
+ *              robots in fixed time steps and detects their collisions.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_FLEETSIMULATOR_H
+#define ENPM809Y_PROJECT_5_FLEETSIMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "MobileRobot.h"
+
+/*!
+ * \class FleetSimulator
+ * \brief The FleetSimulator class simulates a fleet of robots executing move commands
+ * (the kCommand values of PlannerServer, same naming as the BuildStack inputs). The
+ * robots are not objects: every property is one array indexed by robot (structure of
+ * arrays) and the commands of all robots are one byte stream, so a step is a few linear
+ * passes. The move and turn durations are read from the MobileRobot subclass once, when
+ * the robot is added, and no virtual call or allocation happens while stepping. A robot
+ * turns in place before moving when the command is not along its heading, like the FSM
+ * states, and reserves the cell it moves into in an occupancy bitmap. A robot whose next
+ * cell is held by another robot waits, and a command leading into a wall stops it.
+ */
+class FleetSimulator {
+public:
+    /*!
+     * \brief Constructor binding the simulator to a map. The grid must outlive the simulator.
+     * \param grid - bit-packed free space
+     * \param ticks_per_unit - number of steps for an action of cost 1
+     * */
+    explicit FleetSimulator(const BitGrid &grid, const int &ticks_per_unit = 2);
+
+    /*! \brief Default destructor */
+    ~FleetSimulator() = default;
+
+    /*!
+     * \brief Converts a path into move commands
+     * \param path - nodes from start to goal, each next to the previous one
+     * \param commands - output, one command per move
+     * */
+    static void PathToCommands(const std::vector<std::pair<int, int>> &path,
+                               std::vector<std::uint8_t> &commands);
+
+    /*!
+     * \brief Adds a robot, facing up like a robot in its initial FSM state
+     * \param robot - robot giving the move and turn costs
+     * \param start - coordinate of start node, must be free and not occupied
+     * \param commands - commands to execute, in order
+     * \return index of the robot, -1 if the start cell cannot be used
+     * */
+    int AddRobot(const MobileRobot &robot, const std::pair<int, int> &start,
+                 const std::vector<std::uint8_t> &commands);
+
+    /*! \brief Removes every robot */
+    void Clear();
+
+    /*! \brief Advances the simulation by one step */
+    void Step();
+
+    /*!
+     * \brief Steps until every robot has finished or stopped
+     * \param max_steps - maximum number of steps
+     * \return number of steps run
+     * */
+    std::size_t Run(const std::size_t &max_steps);
+
+    /*! \brief Gets the number of robots */
+    std::size_t get_robot_count() const { return x_.size(); }
+
+    /*! \brief Gets the position of a robot */
+    std::pair<int, int> get_position(const std::size_t &robot) const { return {x_[robot], y_[robot]}; }
+
+    /*! \brief Gets the heading of a robot, as a command value */
+    int get_heading(const std::size_t &robot) const { return heading_[robot]; }
+
+    /*! \brief Checks if a robot has executed all its commands */
+    bool is_finished(const std::size_t &robot) const { return cursor_[robot] == end_[robot] && timer_[robot] == 0; }
+
+    /*! \brief Checks if a robot was stopped by a command leading into a wall */
+    bool is_stopped(const std::size_t &robot) const { return is_stopped_[robot] != 0; }
+
+    /*! \brief Gets the number of steps run */
+    std::size_t get_step_count() const { return step_count_; }
+
+    /*! \brief Gets the number of moves, turns and waits over all robots */
+    std::size_t get_move_count() const { return move_count_; }
+    std::size_t get_turn_count() const { return turn_count_; }
+    std::size_t get_wait_count() const { return wait_count_; }
+
+    /*! \brief Gets the number of robots which are neither finished nor stopped */
+    std::size_t get_active_count() const { return active_count_; }
+
+private:
+    /*! \brief Checks and changes the occupancy bit of cell (x,y) */
+    bool IsOccupied(const int &x, const int &y) const {
+        const std::size_t bit = static_cast<std::size_t>(y) * grid_.get_length() + x;
+        return ((occupancy_[bit >> 6] >> (bit & 63)) & 1u) != 0;
+    }
+    void SetOccupied(const int &x, const int &y, const bool &is_occupied);
+
+    /*! \brief Map being simulated */
+    const BitGrid &grid_;
+
+    /*! \brief Steps for an action of cost 1 */
+    int ticks_per_unit_;
+
+    /*! \brief Robot state, one entry per robot */
+    std::vector<std::int32_t> x_, y_;
+    std::vector<std::uint32_t> heading_, timer_, cursor_, end_;
+    std::vector<std::uint32_t> move_ticks_, turn_ticks_, is_stopped_;
+
+    /*! \brief Commands of all robots, robot after robot */
+    std::vector<std::uint8_t> commands_;
+
+    /*! \brief One bit per cell, set where a robot stands */
+    std::vector<std::uint64_t> occupancy_;
+
+    /*! \brief Scratch, robots ready for their next action in the current step */
+    std::vector<std::uint32_t> ready_;
+
+    /*! \brief Counters */
+    std::size_t step_count_ = 0, move_count_ = 0, turn_count_ = 0, wait_count_ = 0, active_count_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_FLEETSIMULATOR_H
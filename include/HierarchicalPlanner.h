@@ -0,0 +1,158 @@
+/*!
+ * \file        HierarchicalPlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file HierarchicalPlanner.h contains the header declarations for
+ *              HierarchicalPlanner class. The class implements hierarchical path
+ *              finding (HPA*) for maps which are too large for a flat A* search.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_HIERARCHICALPLANNER_H
+#define ENPM809Y_PROJECT_5_HIERARCHICALPLANNER_H
+
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+
+/*!
+ * \struct AbstractEdge
+ * \brief Define data structure for an edge of the abstract graph: the node it leads
+ * to and the number of moves it stands for
+ * */
+struct AbstractEdge {
+    int to = -1;
+    int cost = 0;
+};
+
+/*!
+ * \class HierarchicalPlanner
+ * \brief The HierarchicalPlanner class partitions the grid into square clusters. Along
+ * every border between two clusters, each run of free cell pairs becomes one entrance
+ * (two for long runs), and the cells of the entrances are the nodes of an abstract
+ * graph. Nodes of the same cluster are joined by their shortest distance inside the
+ * cluster, nodes of the two sides of an entrance by a single move. A query connects the
+ * start and goal to the nodes of their clusters, runs A* on the abstract graph and only
+ * refines the chosen edges into cells. After a map edit only the clusters touching the
+ * edited cells are searched again.
+ */
+class HierarchicalPlanner {
+public:
+    /*!
+     * \brief Constructor binding the planner to a grid and building the abstract graph.
+     * The grid must outlive the planner and should only be edited through SetFree.
+     * \param grid - bit-packed free space
+     * \param cluster_size - side of a square cluster in cells
+     * */
+    explicit HierarchicalPlanner(BitGrid &grid, const int &cluster_size = 16);
+
+    /*! \brief Default destructor */
+    ~HierarchicalPlanner() = default;
+
+    /*!
+     * \brief Marks the cell at (x,y) as free or blocked and the clusters around it dirty
+     * \param x - x coordinate of node
+     * \param y - y coordinate of node
+     * \param is_free - true to clear the obstacle, false to set it
+     * */
+    void SetFree(const int &x, const int &y, const bool &is_free);
+
+    /*!
+     * \brief Rebuilds the entrances and distances of the dirty clusters only
+     * \return number of clusters whose distances were recomputed
+     * */
+    int Rebuild();
+
+    /*!
+     * \brief Finds a path between start and goal. Pending edits are rebuilt first.
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, nodes from start to goal (both included)
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                 std::vector<std::pair<int, int>> &path);
+
+    /*! \brief Gets the number of nodes in the abstract graph */
+    int get_node_count() const;
+
+    /*! \brief Gets the number of clusters */
+    int get_cluster_count() const;
+
+private:
+    /*! \brief Cluster holding cell (x,y) */
+    int ClusterOf(const int &x, const int &y) const;
+
+    /*!
+     * \brief Finds the entrances across the East or South border of a cluster
+     * \param cluster - cluster index
+     * \param is_east - true for the East border, false for the South border
+     * */
+    void FindEntrances(const int &cluster, const bool &is_east);
+
+    /*!
+     * \brief Collects the nodes of a cluster from its four borders and computes the
+     * distances between them
+     * \param cluster - cluster index
+     * */
+    void BuildCluster(const int &cluster);
+
+    /*! \brief Rebuilds the global abstract graph from the per cluster data */
+    void Assemble();
+
+    /*!
+     * \brief Breadth first search restricted to one cluster
+     * \param cluster - cluster index
+     * \param source - cell index of the source, must be inside the cluster
+     * \param target - cell index to stop at, -1 to search the whole cluster
+     * \return number of cells reached
+     * */
+    int SearchCluster(const int &cluster, const int &source, const int &target);
+
+    /*!
+     * \brief Distance of a cell in the last SearchCluster run
+     * \param cell - cell index inside the searched cluster
+     * \return number of moves, -1 if not reached
+     * */
+    int LocalDistance(const int &cell) const;
+
+    /*!
+     * \brief Appends the cells of the last SearchCluster run from its source to cell
+     * \param cell - cell index reached by the search
+     * \param path - path to append to (the source itself is not appended)
+     * */
+    void AppendLocalPath(const int &cell, std::vector<std::pair<int, int>> &path) const;
+
+    /*! \brief Grid being searched */
+    BitGrid &grid_;
+
+    /*! \brief Side of a cluster and number of clusters along x and y */
+    int cluster_size_, clusters_x_, clusters_y_;
+
+    /*! \brief Entrance cell pairs across the East and South border of every cluster */
+    std::vector<std::vector<std::pair<int, int>>> east_links_, south_links_;
+
+    /*! \brief Entrance cells inside every cluster and the distances between them */
+    std::vector<std::vector<int>> cluster_nodes_, cluster_distance_;
+
+    /*! \brief Clusters edited since the last rebuild */
+    std::set<int> dirty_;
+
+    /*! \brief Abstract graph: node cells, cell to node lookup and adjacency */
+    std::vector<int> nodes_;
+    std::unordered_map<int, int> node_index_;
+    std::vector<std::vector<AbstractEdge>> edges_;
+
+    /*! \brief Scratch buffers of SearchCluster: distance, parent and queue */
+    std::vector<int> local_distance_, local_parent_, local_queue_;
+
+    /*! \brief Origin of the cluster searched last */
+    int local_x0_ = 0, local_y0_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_HIERARCHICALPLANNER_H
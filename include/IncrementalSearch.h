@@ -0,0 +1,126 @@
+/*!
+ * \file        IncrementalSearch.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file IncrementalSearch.h contains the header declarations for
+ *              IncrementalSearch class. The class runs an A* search in slices that
+ *              fit between the ticks of a control loop.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_INCREMENTALSEARCH_H
+#define ENPM809Y_PROJECT_5_INCREMENTALSEARCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include "BitGrid.h"
+#include "Path.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \class IncrementalSearch
+ * \brief The IncrementalSearch class is an A* search on a BitGrid turned inside out:
+ * instead of looping until the goal is found, Step expands at most a given number of
+ * nodes and returns, and RunUntil expands nodes until a deadline. It tries the moves in
+ * the order of Maze::Search, but unlike it uses the Manhattan distance, which is
+ * consistent on a 4-connected grid, and stops when the goal is popped rather than
+ * generated. The open list, costs and parents live in a SearchWorkspace owned by the
+ * object, not in the thread local one, so the search keeps its frontier between calls
+ * while other searches run on the same thread, and it can be resumed from another
+ * thread as long as two threads never step it at the same time.
+ *
+ * A call never blocks and all the state is in the object, so a control loop can give
+ * the search a slice of every tick, and an executor of coroutines or tasks can resume it
+ * like any other task, e.g. by calling Step and yielding until it stops returning
+ * kSearching.
+ */
+class IncrementalSearch {
+public:
+    /*! \brief States of a search */
+    static const int kIdle = -2;
+    static const int kNoPath = -1;
+    static const int kSearching = 0;
+    static const int kFound = 1;
+
+    /*!
+     * \brief Constructor binding the search to a map. The grid must outlive the search.
+     * \param grid - bit-packed free space
+     * */
+    explicit IncrementalSearch(const BitGrid &grid);
+
+    /*! \brief Default destructor */
+    ~IncrementalSearch() = default;
+
+    /*!
+     * \brief Starts a new search, dropping any search in progress. Nothing is expanded
+     * until Step or RunUntil is called.
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \return kSearching, or kNoPath if the start or the goal is blocked or outside the map
+     * */
+    int Start(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Expands nodes until the search ends or a number of expansions is reached
+     * \param max_expansions - most nodes expanded by this call
+     * \return kSearching if the search must be resumed, kFound or kNoPath when it has
+     * ended, kIdle if no search was started
+     * */
+    int Step(const int &max_expansions);
+
+    /*!
+     * \brief Expands nodes until the search ends or a deadline passes. The clock is read
+     * every kSliceExpansions expansions, so the deadline may be overrun by one slice.
+     * \param deadline - time at which the call must return
+     * \return the same as Step
+     * */
+    int RunUntil(const std::chrono::steady_clock::time_point &deadline);
+
+    /*! \brief Abandons the search in progress */
+    void Cancel() { status_ = kIdle; }
+
+    /*!
+     * \brief Gets the path found
+     * \param path - output, cleared unless the search has found the goal
+     * \return true if a path was found, false if else
+     * */
+    bool GetPath(Path &path) const;
+
+    /*! \brief Gets the state of the search */
+    int get_status() const { return status_; }
+
+    /*! \brief Gets the number of nodes expanded since Start */
+    std::uint64_t get_expansions() const { return expansions_; }
+
+    /*! \brief Gets the number of nodes in the frontier */
+    std::size_t get_open_size() const { return workspace_.get_open_size(); }
+
+    /*! \brief Expansions between two clock reads of RunUntil */
+    static const int kSliceExpansions = 256;
+
+private:
+    /*! \brief Manhattan distance from a node to the goal */
+    double Heuristic(const std::pair<int, int> &node) const {
+        return std::abs(node.first - goal_.first) + std::abs(node.second - goal_.second);
+    }
+
+    /*! \brief Map being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Open list, costs and parents, kept between calls */
+    SearchWorkspace workspace_;
+
+    /*! \brief Start and goal of the current search */
+    std::pair<int, int> start_{-1, -1}, goal_{-1, -1};
+
+    /*! \brief State and statistics of the current search */
+    int status_ = kIdle;
+    std::uint64_t expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_INCREMENTALSEARCH_H
@@ -0,0 +1,87 @@
+/*!
+ * \file        LatticePlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file LatticePlanner.h contains the header declarations for
+ *              LatticePlanner class. The class searches over position and heading so
+ *              that turns are paid for with the cost of the robot type.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_LATTICEPLANNER_H
+#define ENPM809Y_PROJECT_5_LATTICEPLANNER_H
+
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "MobileRobot.h"
+
+/*!
+ * \class LatticePlanner
+ * \brief The LatticePlanner class runs A* over (x, y, heading) states. A robot can
+ * move one cell forward along its heading or turn in place by 90 degrees, with the move
+ * and turn costs of its MobileRobot subclass, so a path with fewer turns is preferred
+ * when turning is slow. The four headings of a cell are adjacent states (cell * 4 +
+ * heading) in the search workspace, so the states of one cell share a cache line. The
+ * heuristic counts the moves and the headings the robot still has to take, which never
+ * overestimates.
+ */
+class LatticePlanner {
+public:
+    /*! \brief Heading codes, the direction of the matching FSM state */
+    static const int kHeadingUp = 0;
+    static const int kHeadingDown = 1;
+    static const int kHeadingLeft = 2;
+    static const int kHeadingRight = 3;
+
+    /*!
+     * \brief Constructor binding the planner to a grid. The grid must outlive the planner.
+     * \param grid - bit-packed free space
+     * */
+    explicit LatticePlanner(const BitGrid &grid);
+
+    /*! \brief Default destructor */
+    ~LatticePlanner() = default;
+
+    /*!
+     * \brief Finds the cheapest path for a robot, ending in any heading
+     * \param start - coordinate of start node
+     * \param heading - heading at the start, kHeadingUp for a robot in its initial state
+     * \param goal - coordinate of goal node
+     * \param robot - robot giving the move and turn costs
+     * \param path - output, cells from start to goal (both included), as for Maze::BuildStack
+     * \return cost of the path, -1 if no path exists
+     * */
+    double FindPath(const std::pair<int, int> &start, const int &heading,
+                    const std::pair<int, int> &goal, const MobileRobot &robot,
+                    std::vector<std::pair<int, int>> &path);
+
+    /*! \brief Gets the number of turns of the last path found */
+    int get_turn_count() const { return turn_count_; }
+
+    /*! \brief Gets the number of states expanded by the last query */
+    int get_expansions() const { return expansions_; }
+
+private:
+    /*!
+     * \brief Lower bound of the cost from a state to the goal
+     * \param state - cell * 4 + heading
+     * \return heuristic cost
+     * */
+    double Heuristic(const int &state) const;
+
+    /*! \brief Grid being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Goal and costs of the current query */
+    std::pair<int, int> goal_{-1, -1};
+    double move_cost_ = 1, turn_cost_ = 1;
+
+    /*! \brief Statistics of the last query */
+    int turn_count_ = 0, expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_LATTICEPLANNER_H
@@ -0,0 +1,103 @@
+/*!
+ * \file        MapGenerator.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file MapGenerator.h contains the header declarations for
+ *              MapGenerator class. The class generates seeded mazes and warehouse
+ *              layouts of any size for testing the planners at scale.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_MAPGENERATOR_H
+#define ENPM809Y_PROJECT_5_MAPGENERATOR_H
+
+#include <cstdint>
+#include <string>
+#include "BitGrid.h"
+
+/*!
+ * \struct MapOptions
+ * \brief Define the parameters of a generated map: its size, the seed, the number of
+ * threads (0 for one per hardware thread), the fraction of dead ends removed from a
+ * braided maze, the room size range of a room layout, and the aisle width and rack
+ * length of a warehouse layout
+ * */
+struct MapOptions {
+    int length = 46;
+    int width = 31;
+    std::uint64_t seed = 1;
+    int threads = 0;
+    double braid = 0.5;
+    int room_min = 4;
+    int room_max = 12;
+    int aisle_width = 2;
+    int rack_length = 20;
+};
+
+/*!
+ * \class MapGenerator
+ * \brief The MapGenerator class fills a BitGrid with one of four layouts. The map is cut
+ * into pieces of fixed size (row stripes for mazes and aisles, 512x512 sectors for
+ * rooms) which are generated by the threads with a seed derived from the map seed and
+ * the piece number, and the pieces are joined afterwards. Since the cut does not depend
+ * on the number of threads, a seed always gives the same map.
+ *  - kPerfect: a maze with exactly one path between any two cells, each stripe built by
+ *    a randomized depth first search and joined to the next stripe by one opening;
+ *  - kBraided: a perfect maze in which a fraction of the dead ends are opened into a
+ *    neighbour, which creates loops;
+ *  - kRooms: rectangular rooms chained by corridors inside each sector, and the sectors
+ *    joined to their neighbours by corridors;
+ *  - kWarehouse: two-deep racks separated by aisles, with cross aisles every rack length
+ *    and a perimeter aisle. This layout does not use the seed.
+ * Every layout is surrounded by a wall and its free space is connected.
+ */
+class MapGenerator {
+public:
+    /*! \brief Layout kinds */
+    static const int kPerfect = 0;
+    static const int kBraided = 1;
+    static const int kRooms = 2;
+    static const int kWarehouse = 3;
+
+    /*!
+     * \brief Constructor storing the parameters
+     * \param options - size, seed and layout parameters
+     * */
+    explicit MapGenerator(const MapOptions &options);
+
+    /*! \brief Default destructor */
+    ~MapGenerator() = default;
+
+    /*!
+     * \brief Converts a layout name to its kind
+     * \param name - "perfect", "braided", "rooms" or "warehouse"
+     * \return layout kind, -1 for an unknown name
+     * */
+    static int KindOf(const std::string &name);
+
+    /*!
+     * \brief Generates a layout
+     * \param kind - one of the layout kinds
+     * \param grid - output, resized to the map size
+     * \return true if the map was generated, false for an unknown kind or a size too small
+     * */
+    bool Generate(const int &kind, BitGrid &grid) const;
+
+private:
+    /*! \brief Carves a perfect maze, and braids it if is_braided */
+    void GenerateMaze(BitGrid &grid, const bool &is_braided) const;
+
+    /*! \brief Carves rooms joined by corridors */
+    void GenerateRooms(BitGrid &grid) const;
+
+    /*! \brief Carves racks and aisles */
+    void GenerateWarehouse(BitGrid &grid) const;
+
+    /*! \brief Parameters */
+    MapOptions options_;
+};
+
+#endif // ENPM809Y_PROJECT_5_MAPGENERATOR_H
@@ -17,10 +17,19 @@
 #include <iostream>
 #include <utility>
 #include <array>
-#include <map>
+#include <chrono>
+#include <cstdint>
 #include <stack>
 #include <memory>
+#include <string>
+#include <vector>
+#include "AllocationCounter.h"
+#include "CommandRing.h"
 #include "MobileRobot.h"
+#include "Path.h"
+#include "PlannerMetrics.h"
+#include "SearchTracer.h"
+#include "SearchWorkspace.h"
 
 /*!
  * \struct ListInfo
@@ -42,7 +51,12 @@ struct ListInfo {
  * for solving our path finding problem. The algorithm accepts a start position
  * and goal position and finds a shortest path. The complexity of our algorithm
  * is O(log n) because we use only one for loop to iterate through entries of
- * priority list_. The algorithm finds the shortest path very quick
+ * priority list_. The algorithm finds the shortest path very quick.
+ * The priority, open and closed lists live in the SearchWorkspace of the calling
+ * thread: a node is in the closed list when it is closed in the workspace, in the
+ * open list when it is seen but not closed, and the priority list is the workspace
+ * heap. Each Action() resets the workspace in O(1), so repeated queries reuse the
+ * same memory instead of growing STL maps node by node.
  */
 class Maze {
 public:
@@ -121,6 +135,35 @@ public:
      * */
     void BuildStack(const std::shared_ptr<MobileRobot> &robot_in_maze);
 
+    /*!
+     * \brief build stack of moving sequence from a path found by another planner
+     * \param path - nodes from start to goal (both included)
+     * \param robot_in_maze - pointer of robot object, polymorphism takes place
+     * inside this function.
+     * */
+    void BuildStack(const std::vector<std::pair<int, int>> &path,
+                    const std::shared_ptr<MobileRobot> &robot_in_maze) const;
+
+    /*!
+     * \brief build stack of moving sequence from a path found before, without searching
+     * \param path - view of the path, prints that there is no path if empty
+     * \param robot_in_maze - pointer of robot object, polymorphism takes place
+     * inside this function.
+     * */
+    void BuildStack(const PathView &path, const std::shared_ptr<MobileRobot> &robot_in_maze) const;
+
+    /*!
+     * \brief build moving sequence as a stream: searches from the goal back to the start,
+     * so that walking the parents from the start gives the moves in the order the robot
+     * drives them, and pushes each move into a ring as soon as it is known. A
+     * CommandExecutor draining the ring drives the robot before the walk reaches the goal,
+     * and a full ring holds the walk back. The moves go to MobileRobot::Execute, not onto
+     * the plan stack filled by BuildStack.
+     * \param ring - ring receiving the move codes, closed on return
+     * \return 1 if the path is found and -1 if else
+     * */
+    int StreamStack(CommandRing &ring);
+
     /*!
      * \brief Get next node location given current node location when going up
      * \param node - coordinate of current node
@@ -204,6 +247,14 @@ public:
      * */
     int Action();
 
+    /*!
+     * \brief Runs the A* algorithm like Action and builds the path found into the
+     * storage of the caller, so that it can be plotted and executed without searching again
+     * \param path - output, cleared if no path is found
+     * \return 1 if the path is found and -1 if else
+     * */
+    int Action(Path &path);
+
     /*!
      * \brief Computes the euclidean distance between given current node and goal node
      * \param current_node - coordinate of current node
@@ -231,6 +282,14 @@ public:
      * */
     int PlotTrajectory(const char &path_icon);
 
+    /*!
+     * \brief Plots a path found before, without searching
+     * \param path - view of the path
+     * \param path_icon - - or + for tracked or wheeled robots
+     * \return 0 if the path exists and 1 if else
+     * */
+    int PlotTrajectory(const PathView &path, const char &path_icon);
+
     /*!
      * \brief Gets the length of the maze.
      * \return length of the maze
@@ -243,7 +302,52 @@ public:
      * */
     int get_width() const;
 
+    /*!
+     * \brief Attaches a tracer which records the expansions and generations of the
+     * following searches. Only effective when built with MAZE_ENABLE_TRACING.
+     * \param tracer - tracer to record to, nullptr to stop recording
+     * */
+    void set_tracer(SearchTracer *tracer);
+
+    /*!
+     * \brief Attaches a metrics registry. Every following Action, PlotTrajectory and
+     * BuildStack records its latency, expansions and path length under engine "astar".
+     * \param metrics - registry to record to, nullptr to stop recording
+     * \param robot_type - robot type label, e.g. the name of the robot using this maze
+     * */
+    void set_metrics(PlannerMetrics *metrics, const std::string &robot_type);
+
 private:
+    /*!
+     * \brief Runs the A* search described in Action
+     * \return 1 if the path is found and -1 if else
+     * */
+    int Search();
+
+    /*!
+     * \brief Records the last search into some metrics, if attached
+     * \param metrics - metrics to record to, may be null
+     * \param begin - time at which the measured call started
+     * \param status - 1 if the search found a path, anything else if not
+     * \param allocations - allocations counted since the measured call started
+     * */
+    void RecordQuery(QueryMetrics *metrics, const std::chrono::steady_clock::time_point &begin,
+                     const int &status, const AllocationScope &allocations) const;
+
+    /*!
+     * \brief Converts a node to its index in the search workspace
+     * \param node - coordinate of node, must be within the maze
+     * \return index y * length + x
+     * */
+    int ToIndex(const std::pair<int, int> &node) const;
+
+    /*!
+     * \brief Converts a workspace index back to a node
+     * \param index - index y * length + x
+     * \return coordinate of node
+     * */
+    std::pair<int, int> ToNode(const int &index) const;
+
     /*! \brief Pre-define width as 31 due to the fact the maze is given */
     const int width_ = 31;
 
@@ -256,11 +360,19 @@ private:
     /*! \brief Our start and goal nodes*/
     std::pair<int, int> start_, goal_;
 
-    /*! \brief C++ STL data structure to store priority list*/
-    std::multimap<double, ListInfo> priority_list_;
+    /*! \brief Tracer attached to the searches, if any */
+    SearchTracer *tracer_ = nullptr;
+
+    /*! \brief Metrics of Action, PlotTrajectory and BuildStack, if attached */
+    QueryMetrics *action_metrics_ = nullptr;
+    QueryMetrics *plot_metrics_ = nullptr;
+    QueryMetrics *build_metrics_ = nullptr;
+
+    /*! \brief Nodes expanded by the last search */
+    std::uint64_t expansions_ = 0;
 
-    /*! \brief  C++ STL data structure to store open and closed lists*/
-    std::map<std::pair<int, int>, ListInfo> open_list_, closed_list_;
+    /*! \brief Path of PlotTrajectory and BuildStack when they search themselves */
+    Path path_;
 };
 
 #endif //ENPM809Y_PROJECT_5_A_STAR_H
@@ -14,15 +14,25 @@
 #ifndef ENPM809Y_PROJECT_5_MOBILEROBOT_H
 #define ENPM809Y_PROJECT_5_MOBILEROBOT_H
 
+#include <cstdint>
 #include <iostream>
 #include <stack>
 #include <string>
+#include "CostMap.h"
 #include "RobotState.h"
 
 /*!
  * \class MobileRobot
  * \brief The MobileRobot class is the base class for WheeledRobot class and
  * TrackedRobot.
+ *
+ * A robot runs the state machine in two ways. HandleInput pushes a planned move onto
+ * the plan stack, which Maze::BuildStack fills from the last move back to the first so
+ * that the first move ends on top and ShowStack prints the plan in driving order.
+ * Execute runs a move now, for the producers which send the moves in driving order:
+ * CommandExecutor and RealTimePlanner. The current state handles the move and pushes the
+ * next state, which then replaces it, so a robot driven for ever holds one state and the
+ * plan stack is left as it was.
  */
 class MobileRobot {
 public:
@@ -34,8 +44,12 @@ public:
      */
     explicit MobileRobot(std::string RobotName);
 
-    /*! \brief Default destructor.*/
-    ~MobileRobot() = default;
+    /*! \brief Destructor freeing the current state, virtual so that a robot is freed
+     * through any pointer.*/
+    virtual ~MobileRobot();
+
+    MobileRobot(const MobileRobot &) = delete;
+    MobileRobot &operator=(const MobileRobot &) = delete;
 
     /*! \brief Virtual function to handle input.
      * \param input - input robot state.
@@ -45,6 +59,62 @@ public:
     /*! \brief Virtual function to print the stack.*/
     virtual void ShowStack() = 0;
 
+    /*!
+     * \brief Function to get the cost of moving forward by one cell.
+     * \return cost of one move, 1 unless the robot type says otherwise
+     * */
+    virtual double get_move_cost() const { return 1; }
+
+    /*!
+     * \brief Function to get the cost of turning in place by 90 degrees.
+     * \return cost of one turn, 1 unless the robot type says otherwise
+     * */
+    virtual double get_turn_cost() const { return 1; }
+
+    /*!
+     * \brief Function to get the cost of moving into a cell of a given terrain. The
+     * planners read it once per query into a table, so it may be as slow as needed.
+     * \param terrain - terrain class of the cell, one of the CostMap classes
+     * \return integer cost of the move between 1 and 255, 0 if the robot cannot enter
+     * */
+    virtual int get_terrain_cost(const std::uint8_t &terrain) const {
+        switch (terrain) {
+            case CostMap::kFloor:
+            case CostMap::kNoStop:
+                return 1;
+            case CostMap::kRamp:
+                return 2;
+            case CostMap::kSlow:
+                return 3;
+            case CostMap::kRough:
+                return 4;
+            default:
+                return 0;
+        }
+    }
+
+    /*!
+     * \brief Function to execute one move now: the current state handles it and the
+     * state of the move becomes the current state. The plan stack is left untouched.
+     * \param input - "UP", "DOWN", "LEFT" or "RIGHT", other inputs are ignored
+     * */
+    void Execute(const std::string &input);
+
+    /*!
+     * \brief Function to get the name of the current state, "Up" before any move. It is
+     * not synchronised: read it on the thread executing the moves, or after
+     * CommandExecutor::Join.
+     * \return name of the current state
+     * */
+    std::string get_state_name() const;
+
+    /*!
+     * \brief Function to get the number of moves executed, with the same rule as
+     * get_state_name.
+     * \return number of moves
+     * */
+    std::uint64_t get_executed_count() const { return executed_count_; }
+
     /*!
      * \brief Function to get name.
      * \return name of the robot
@@ -54,6 +124,12 @@ public:
 private:
     /*! \brief Name member for the robot.*/
     std::string name_;
+
+    /*! \brief Current state, alone on its stack once a move has been executed.*/
+    state::StateStack current_;
+
+    /*! \brief Number of moves executed.*/
+    std::uint64_t executed_count_ = 0;
 };
 
 #endif // ENPM809Y_PROJECT_5_MOBILEROBOT_H
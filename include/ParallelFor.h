@@ -0,0 +1,38 @@
+/*!
+ * \file        ParallelFor.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file ParallelFor.h contains the declarations of ParallelFor and
+ *              ThreadCount, which share the work of the map builders between threads.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PARALLELFOR_H
+#define ENPM809Y_PROJECT_5_PARALLELFOR_H
+
+#include <functional>
+
+/*!
+ * \brief Resolves a requested number of threads
+ * \param threads - number of threads, 0 for one per hardware thread
+ * \return number of threads, at least 1
+ * */
+int ThreadCount(const int &threads);
+
+/*!
+ * \brief Runs a task over [0, count) cut into chunks. Each thread takes the next chunk
+ * not run yet until none is left; the calling thread is one of them.
+ * \param count - number of indices
+ * \param threads - number of threads, 0 for one per hardware thread; no more threads
+ * than chunks are started
+ * \param chunk - indices handed to a thread at a time
+ * \param task - function of the chunk [begin, end) and of the thread number, which is
+ * below ThreadCount(threads), so that it can index per thread scratch
+ * */
+void ParallelFor(const int &count, const int &threads, const int &chunk,
+                 const std::function<void(int, int, int)> &task);
+
+#endif // ENPM809Y_PROJECT_5_PARALLELFOR_H
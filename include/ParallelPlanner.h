@@ -0,0 +1,209 @@
+/*!
+ * \file        ParallelPlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file ParallelPlanner.h contains the header declarations for
+ *              ParallelPlanner class. The class implements hash distributed A*
+ *              (HDA*) which spreads one query over several threads.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PARALLELPLANNER_H
+#define ENPM809Y_PROJECT_5_PARALLELPLANNER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+
+/*!
+ * \class ParallelPlanner
+ * \brief The ParallelPlanner class runs one optimal A* query on several threads. Every
+ * cell is owned by one thread, chosen by Zobrist hashing of the 4x4 block holding the
+ * cell, so neighbouring cells mostly share an owner. A thread only expands the cells it
+ * owns and is the only one to write their cost and parent, which needs no lock. These are
+ * kept in arrays of the owner, block after block, so that two threads never write the
+ * same cache line. Successors
+ * owned by another thread are sent to it in batches through a lock-free inbox. The best
+ * path to the goal found so far prunes every node whose total cost cannot beat it, and
+ * the search ends when every thread is idle and no message is in flight.
+ */
+class ParallelPlanner {
+public:
+    /*!
+     * \brief Constructor binding the planner to a grid. The grid must outlive the planner.
+     * \param grid - bit-packed free space
+     * \param threads - number of search threads, 0 for one per hardware thread
+     * */
+    explicit ParallelPlanner(const BitGrid &grid, const int &threads = 0);
+
+    /*! \brief Destructor freeing the messages left in the inboxes */
+    ~ParallelPlanner();
+
+    ParallelPlanner(const ParallelPlanner &) = delete;
+    ParallelPlanner &operator=(const ParallelPlanner &) = delete;
+
+    /*!
+     * \brief Finds a shortest path between start and goal
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, nodes from start to goal (both included)
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                 std::vector<std::pair<int, int>> &path);
+
+    /*! \brief Gets the number of search threads */
+    int get_thread_count() const { return static_cast<int>(workers_.size()); }
+
+    /*! \brief Gets the number of nodes expanded by the last query over all threads */
+    std::size_t get_expansions() const;
+
+    /*! \brief Gets the number of messages sent between threads by the last query */
+    std::size_t get_messages() const;
+
+private:
+    /*!
+     * \struct Message
+     * \brief Define a successor sent to its owner: the cell, its cost to come and the
+     * cell it was reached from
+     * */
+    struct Message {
+        int state;
+        int cost;
+        int parent;
+    };
+
+    /*!
+     * \struct Batch
+     * \brief Define a batch of messages, linked into the inbox of the receiving thread
+     * */
+    struct Batch {
+        std::vector<Message> messages;
+        Batch *next = nullptr;
+    };
+
+    /*!
+     * \struct OpenEntry
+     * \brief Define an entry of the open list of a thread
+     * */
+    struct OpenEntry {
+        int priority;
+        int cost;
+        int state;
+    };
+
+    /*!
+     * \struct Worker
+     * \brief Define the state of a search thread: its inbox (a Treiber stack of batches
+     * written by any thread), its open list, its outgoing batches, the query stamp, cost
+     * and parent of the cells it owns, and statistics. Aligned, allocation included, so
+     * that two workers never share a cache line.
+     * */
+    struct alignas(64) Worker {
+        /*! \brief Allocates a worker on a cache line boundary, which plain new does not
+         * do for over-aligned types before C++17 */
+        static void *operator new(std::size_t size);
+
+        /*! \brief Frees a worker */
+        static void operator delete(void *pointer);
+
+        std::atomic<Batch *> inbox{nullptr};
+        std::atomic<bool> is_idle{false};
+        std::vector<OpenEntry> open;
+        std::vector<Batch *> outgoing;
+        std::vector<Batch *> spare;
+        std::vector<std::uint32_t> stamp;
+        std::vector<int> cost, parent;
+        std::size_t expansions = 0;
+        std::size_t sent = 0;
+    };
+
+    /*! \brief Thread owning cell (x,y) */
+    int OwnerOf(const int &x, const int &y) const {
+        return static_cast<int>((zobrist_x_[x >> 2] ^ zobrist_y_[y >> 2]) % workers_.size());
+    }
+
+    /*! \brief Index of cell (x,y) in the arrays of its owner */
+    std::size_t SlotOf(const int &x, const int &y) const {
+        return block_slots_[static_cast<std::size_t>((y >> 2) * blocks_x_ + (x >> 2))] +
+               static_cast<std::size_t>(((y & 3) << 2) + (x & 3));
+    }
+
+    /*! \brief Main loop of search thread id */
+    void Search(const int &id);
+
+    /*!
+     * \brief Offers a cost to a cell owned by thread id, keeping it if it is better
+     * \param id - owner thread
+     * \param message - cell, cost and parent
+     * */
+    void Relax(const int &id, const Message &message);
+
+    /*!
+     * \brief Queues a successor for its owner, sending the batch once it is full
+     * \param id - sending thread
+     * \param owner - receiving thread
+     * \param message - cell, cost and parent
+     * */
+    void Send(const int &id, const int &owner, const Message &message);
+
+    /*!
+     * \brief Sends every non-empty outgoing batch of a thread
+     * \param id - sending thread
+     * */
+    void Flush(const int &id);
+
+    /*!
+     * \brief Moves every message of the inbox of a thread into its open list
+     * \param id - receiving thread
+     * \return true if there was at least one message
+     * */
+    bool Receive(const int &id);
+
+    /*!
+     * \brief Checks if the search is over: every thread idle and no message in flight
+     * \return true if the search is over
+     * */
+    bool IsFinished() const;
+
+    /*! \brief Grid being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Random words of the block columns and rows */
+    std::vector<std::uint32_t> zobrist_x_, zobrist_y_;
+
+    /*! \brief Per thread state */
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    /*! \brief Index of the first cell of every 4x4 block in the arrays of its owner, and
+     * the number of blocks in a row */
+    std::vector<std::size_t> block_slots_;
+    int blocks_x_ = 0;
+
+    /*! \brief Current query stamp */
+    std::uint32_t epoch_ = 0;
+
+    /*! \brief Goal of the current query */
+    int goal_x_ = 0, goal_y_ = 0, goal_state_ = -1;
+
+    /*! \brief Cost of the best path to the goal found so far */
+    std::atomic<int> incumbent_{0};
+
+    /*! \brief Messages sent but not received yet */
+    std::atomic<long> in_flight_{0};
+
+    /*! \brief Incremented every time a thread leaves the idle state */
+    std::atomic<std::uint64_t> activity_{0};
+
+    /*! \brief Set once the search is over */
+    std::atomic<bool> is_finished_{false};
+};
+
+#endif // ENPM809Y_PROJECT_5_PARALLELPLANNER_H
@@ -0,0 +1,203 @@
+/*!
+ * \file        Path.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file Path.h contains the header declarations for Path and
+ *              PathView classes. They hold the result of a search as a compact
+ *              stream of moves which can be read many times without copying.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PATH_H
+#define ENPM809Y_PROJECT_5_PATH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \class PathView
+ * \brief The PathView class reads a path without owning it: the start cell and the moves
+ * packed two bits each, 32 moves per 64 bit word, with the codes of the robot commands
+ * (Up, Down, Left, Right as in PlannerServer). Iterating a view gives the nodes from
+ * start to goal, each computed from the previous one, so rendering, command generation
+ * and overlays all read the same few words. A view is valid as long as the Path it came
+ * from is neither changed nor destroyed.
+ */
+class PathView {
+public:
+    /*! \brief Move codes, the same as the robot commands */
+    static const std::uint8_t kUp = 0;
+    static const std::uint8_t kDown = 1;
+    static const std::uint8_t kLeft = 2;
+    static const std::uint8_t kRight = 3;
+
+    /*!
+     * \class Iterator
+     * \brief Forward iterator over the nodes of a path, start included
+     * */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<int, int>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::pair<int, int> *;
+        using reference = const std::pair<int, int> &;
+
+        /*!
+         * \brief Constructor for the iterator at a given node
+         * \param words - packed moves
+         * \param moves - number of moves
+         * \param index - index of the node, 0 for the start
+         * \param node - coordinate of the node
+         * */
+        Iterator(const std::uint64_t *words, const std::size_t &moves, const std::size_t &index,
+                 const std::pair<int, int> &node) : words_{words}, moves_{moves}, index_{index}, node_{node} {}
+
+        /*! \brief Coordinate of the current node */
+        reference operator*() const { return node_; }
+        pointer operator->() const { return &node_; }
+
+        /*! \brief Moves to the next node */
+        Iterator &operator++() {
+            if (index_ < moves_) {
+                const std::uint8_t move = static_cast<std::uint8_t>((words_[index_ >> 5] >> ((index_ & 31) * 2)) & 3u);
+                node_.first += move == kRight ? 1 : move == kLeft ? -1 : 0;
+                node_.second += move == kUp ? 1 : move == kDown ? -1 : 0;
+            }
+            index_++;
+            return *this;
+        }
+
+        /*! \brief Moves to the next node, returning the current one */
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        /*! \brief Compares the positions of two iterators of the same view */
+        bool operator==(const Iterator &other) const { return index_ == other.index_; }
+        bool operator!=(const Iterator &other) const { return index_ != other.index_; }
+
+    private:
+        /*! \brief Moves being read */
+        const std::uint64_t *words_;
+        std::size_t moves_;
+
+        /*! \brief Index and coordinate of the current node */
+        std::size_t index_;
+        std::pair<int, int> node_;
+    };
+
+    /*! \brief Default constructor for the view of no path */
+    PathView() = default;
+
+    /*!
+     * \brief Constructor for the view of some packed moves
+     * \param words - packed moves
+     * \param moves - number of moves
+     * \param start - coordinate of start node, (-1,-1) for no path
+     * */
+    PathView(const std::uint64_t *words, const std::size_t &moves, const std::pair<int, int> &start)
+            : words_{words}, moves_{moves}, start_{start} {}
+
+    /*! \brief Checks if the view holds no path, which differs from a path of no move */
+    bool IsEmpty() const { return start_.first < 0; }
+
+    /*! \brief Gets the number of moves */
+    std::size_t get_move_count() const { return moves_; }
+
+    /*!
+     * \brief Gets a move
+     * \param index - index of the move, from 0 for the move leaving the start
+     * \return move code
+     * */
+    std::uint8_t get_move(const std::size_t &index) const {
+        return static_cast<std::uint8_t>((words_[index >> 5] >> ((index & 31) * 2)) & 3u);
+    }
+
+    /*! \brief Gets the coordinate of start node */
+    std::pair<int, int> get_start() const { return start_; }
+
+    /*! \brief Iterators over the nodes from start to goal, both included */
+    Iterator begin() const { return Iterator(words_, moves_, 0, start_); }
+    Iterator end() const { return Iterator(words_, moves_, IsEmpty() ? 0 : moves_ + 1, start_); }
+
+private:
+    /*! \brief Packed moves */
+    const std::uint64_t *words_ = nullptr;
+    std::size_t moves_ = 0;
+
+    /*! \brief Start node */
+    std::pair<int, int> start_{-1, -1};
+};
+
+/*!
+ * \class Path
+ * \brief The Path class owns the result of a search: the start node and the moves to
+ * the goal, packed as for PathView, which is 16 times smaller than a vector of nodes.
+ * Building a path reuses the storage of the previous one, so a caller which keeps its
+ * Path between queries does not allocate once the storage has grown to its longest path.
+ */
+class Path {
+public:
+    /*! \brief Default constructor for no path */
+    Path() = default;
+
+    /*! \brief Default destructor */
+    ~Path() = default;
+
+    /*! \brief Forgets the path, keeping the storage */
+    void Clear();
+
+    /*!
+     * \brief Builds the path by walking the parents of a search from the goal back to the
+     * start, whose parent is itself. The walk is made twice, to count and then to write the
+     * moves in place, so no temporary is needed.
+     * \param workspace - search whose states are cell indices y * length + x
+     * \param goal_cell - index of goal node, reached by the search
+     * \param length - length of the map
+     * */
+    void Reconstruct(const SearchWorkspace &workspace, const int &goal_cell, const int &length);
+
+    /*!
+     * \brief Builds the path from its nodes, as returned by the other planners
+     * \param nodes - nodes from start to goal, each next to the previous one, empty for no path
+     * */
+    void Assign(const std::vector<std::pair<int, int>> &nodes);
+
+    /*! \brief View of the path */
+    PathView View() const { return PathView(words_.data(), moves_, start_); }
+
+    /*! \brief Checks if there is no path */
+    bool IsEmpty() const { return start_.first < 0; }
+
+    /*! \brief Gets the number of moves */
+    std::size_t get_move_count() const { return moves_; }
+
+private:
+    /*! \brief Sizes the storage for a number of moves, all zero */
+    void Resize(const std::size_t &moves);
+
+    /*! \brief Sets a move, the storage must be sized */
+    void SetMove(const std::size_t &index, const std::uint8_t &move) {
+        words_[index >> 5] |= static_cast<std::uint64_t>(move) << ((index & 31) * 2);
+    }
+
+    /*! \brief Packed moves, 32 per word */
+    std::vector<std::uint64_t, TrackedAllocator<std::uint64_t>> words_;
+    std::size_t moves_ = 0;
+
+    /*! \brief Start node, (-1,-1) for no path */
+    std::pair<int, int> start_{-1, -1};
+};
+
+#endif // ENPM809Y_PROJECT_5_PATH_H
@@ -0,0 +1,152 @@
+/*!
+ * \file        PathDatabase.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file PathDatabase.h contains the header declarations for
+ *              PathDatabase class. The class stores the optimal first move between
+ *              every pair of cells of a fixed map so that queries need no search.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PATHDATABASE_H
+#define ENPM809Y_PROJECT_5_PATHDATABASE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+
+/*!
+ * \struct PathDatabaseHeader
+ * \brief Define the header stored at the start of a path database file. It is followed
+ * by the cell of every rank, the component of every rank, the first run of every row
+ * (plus one end marker) and the runs themselves, all as 32 bit words.
+ * */
+struct PathDatabaseHeader {
+    char magic[4] = {'M', 'Z', 'P', 'D'};
+    std::uint32_t version = 1;
+    std::uint32_t length = 0;
+    std::uint32_t width = 0;
+    std::uint32_t free_cells = 0;
+    std::uint32_t run_count = 0;
+};
+
+/*!
+ * \class PathDatabase
+ * \brief The PathDatabase class is a compressed path database. The free cells are
+ * ranked in depth first order, so that cells with close ranks are close on the map.
+ * For every source cell a breadth first search finds the first move of an optimal path
+ * towards every target, and the row of first moves, in target rank order, is stored as
+ * runs of equal moves. Targets for which the move does not matter (the source itself and
+ * cells of other connected components) extend the previous run. A query walks the first
+ * moves from the start, one binary search in a row per move, and the path can be given
+ * straight to Maze::BuildStack.
+ */
+class PathDatabase {
+public:
+    /*! \brief First move codes, same naming as the "UP", "DOWN", "LEFT", "RIGHT" inputs */
+    static const int kMoveUp = 0;
+    static const int kMoveDown = 1;
+    static const int kMoveLeft = 2;
+    static const int kMoveRight = 3;
+
+    /*! \brief Default constructor for an empty database */
+    PathDatabase() = default;
+
+    /*! \brief Default destructor */
+    ~PathDatabase() = default;
+
+    /*!
+     * \brief Computes the database of a map, one search per free cell
+     * \param grid - bit-packed free space
+     * \param threads - number of build threads, 0 for one per hardware thread
+     * \return number of runs stored
+     * */
+    std::size_t Build(const BitGrid &grid, const int &threads = 0);
+
+    /*!
+     * \brief Writes the database to a binary file
+     * \param path - file name
+     * \return true if the file was written, false if else
+     * */
+    bool Save(const std::string &path) const;
+
+    /*!
+     * \brief Reads a database from a binary file and checks that it matches the map
+     * \param path - file name
+     * \param grid - map the database must have been built for
+     * \return true if the database was loaded, false if else
+     * */
+    bool Load(const std::string &path, const BitGrid &grid);
+
+    /*!
+     * \brief Optimal first move from a source towards a target
+     * \param source - coordinate of source node
+     * \param target - coordinate of target node
+     * \return one of the kMove values, -1 if no path exists or source equals target
+     * */
+    int FirstMove(const std::pair<int, int> &source, const std::pair<int, int> &target) const;
+
+    /*!
+     * \brief Finds a shortest path by walking first moves
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, nodes from start to goal (both included)
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                 std::vector<std::pair<int, int>> &path) const;
+
+    /*! \brief Gets the number of free cells covered */
+    std::size_t get_free_cells() const { return cells_.size(); }
+
+    /*! \brief Gets the number of runs stored */
+    std::size_t get_run_count() const { return runs_.size(); }
+
+    /*! \brief Gets the size of the database in bytes */
+    std::size_t get_bytes() const;
+
+private:
+    /*! \brief Ranks the free cells of the map in depth first order */
+    void RankCells(const BitGrid &grid);
+
+    /*!
+     * \brief Rank of a node
+     * \param node - coordinate of node
+     * \return rank, -1 if the node is outside the map or blocked
+     * */
+    int RankOf(const std::pair<int, int> &node) const;
+
+    /*!
+     * \brief Searches from one source and appends its compressed row
+     * \param source - rank of the source
+     * \param first - scratch, first move of every rank
+     * \param queue - scratch, search queue of ranks
+     * \param row - output, runs of the row
+     * */
+    void BuildRow(const int &source, std::vector<std::int8_t> &first, std::vector<int> &queue,
+                  std::vector<std::uint32_t> &row) const;
+
+    /*! \brief Size of the map */
+    int length_ = 0, width_ = 0;
+
+    /*! \brief Rank of every cell (-1 for blocked cells) and cell of every rank */
+    std::vector<int> rank_;
+    std::vector<std::uint32_t> cells_;
+
+    /*! \brief Connected component of every rank */
+    std::vector<std::uint32_t> component_;
+
+    /*! \brief Index of the first run of every row, plus the end of the last row */
+    std::vector<std::uint32_t> row_start_;
+
+    /*! \brief Runs, (first target rank << 2) | move */
+    std::vector<std::uint32_t> runs_;
+};
+
+#endif // ENPM809Y_PROJECT_5_PATHDATABASE_H
@@ -0,0 +1,190 @@
+/*!
+ * \file        PlannerMetrics.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file PlannerMetrics.h contains the header declarations for
+ *              Histogram, QueryMetrics and PlannerMetrics classes. They keep the
+ *              distributions of query latency, expansions and path length.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PLANNERMETRICS_H
+#define ENPM809Y_PROJECT_5_PLANNERMETRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AllocationCounter.h"
+
+/*!
+ * \class Histogram
+ * \brief The Histogram class counts values in log-linear buckets, like an HDR histogram:
+ * values below 64 have a bucket each, and every power of two above is split into 32
+ * buckets, so any value is known within about 3% whatever its magnitude. Recording is
+ * a few relaxed atomic additions, so any number of threads can record concurrently
+ * without a lock, and reading gives a consistent enough view for monitoring.
+ */
+class Histogram {
+public:
+    /*! \brief Default constructor for an empty histogram */
+    Histogram();
+
+    /*! \brief Default destructor */
+    ~Histogram() = default;
+
+    Histogram(const Histogram &) = delete;
+    Histogram &operator=(const Histogram &) = delete;
+
+    /*!
+     * \brief Counts one value
+     * \param value - value to be counted
+     * */
+    void Record(const std::uint64_t &value);
+
+    /*!
+     * \brief Value below which a given fraction of the counted values fall
+     * \param quantile - fraction between 0 and 1, e.g. 0.99
+     * \return upper bound of the bucket holding the quantile, 0 if nothing was counted
+     * */
+    std::uint64_t ValueAtQuantile(const double &quantile) const;
+
+    /*! \brief Gets the number of values counted */
+    std::uint64_t get_count() const { return count_.load(std::memory_order_relaxed); }
+
+    /*! \brief Gets the sum of the values counted */
+    std::uint64_t get_sum() const { return sum_.load(std::memory_order_relaxed); }
+
+    /*! \brief Gets the largest value counted */
+    std::uint64_t get_max() const { return max_.load(std::memory_order_relaxed); }
+
+private:
+    /*! \brief Bucket holding a value */
+    static std::size_t BucketOf(const std::uint64_t &value);
+
+    /*! \brief Largest value of a bucket */
+    static std::uint64_t UpperBound(const std::size_t &bucket);
+
+    /*! \brief Count of every bucket */
+    std::unique_ptr<std::atomic<std::uint64_t>[]> buckets_;
+
+    /*! \brief Totals */
+    std::atomic<std::uint64_t> count_{0}, sum_{0}, max_{0};
+};
+
+/*!
+ * \class QueryMetrics
+ * \brief The QueryMetrics class holds the histograms of one kind of query: latency in
+ * nanoseconds, expanded nodes and path length in moves, and the number of queries which
+ * found no path. With allocation counting on, it also holds the allocations, the bytes
+ * allocated and the peak of the bytes held by the containers during a query.
+ */
+class QueryMetrics {
+public:
+    /*!
+     * \brief Records one query
+     * \param elapsed - time taken
+     * \param expanded - nodes expanded, 0 if the engine does not count them
+     * \param length - number of moves, -1 if no path was found
+     * */
+    void Record(const std::chrono::nanoseconds &elapsed, const std::uint64_t &expanded,
+                const int &length);
+
+    /*!
+     * \brief Records the allocations of one query
+     * \param stats - allocations counted during the query
+     * */
+    void RecordAllocations(const AllocationStats &stats);
+
+    /*! \brief Histograms and failure counter */
+    Histogram latency, expansions, path_length;
+
+    /*! \brief Histograms of the allocations, empty unless allocation counting is on */
+    Histogram allocations, allocated_bytes, peak_live_bytes;
+    std::atomic<std::uint64_t> failures{0};
+};
+
+/*!
+ * \class PlannerMetrics
+ * \brief The PlannerMetrics class is the registry of QueryMetrics, one per engine,
+ * operation and robot type. Looking a QueryMetrics up takes a lock, so callers keep
+ * the reference they get (it stays valid for the life of the registry) and then record
+ * lock-free. The registry is written as a Prometheus text file, as a summary with
+ * quantiles per histogram, to a temporary file renamed over the target so that a
+ * reader never sees a partial file. The file can be rewritten periodically by a
+ * background thread for the node exporter text file collector.
+ */
+class PlannerMetrics {
+public:
+    /*! \brief Default constructor for an empty registry */
+    PlannerMetrics() = default;
+
+    /*! \brief Destructor stopping the periodic dump */
+    ~PlannerMetrics();
+
+    PlannerMetrics(const PlannerMetrics &) = delete;
+    PlannerMetrics &operator=(const PlannerMetrics &) = delete;
+
+    /*!
+     * \brief Gets the metrics of a kind of query, creating them on first use
+     * \param engine - planner, e.g. "astar"
+     * \param operation - call being measured, e.g. "action"
+     * \param robot - robot type, e.g. "Wheeled Robot"
+     * \return metrics, valid for the life of the registry
+     * */
+    QueryMetrics &Get(const std::string &engine, const std::string &operation, const std::string &robot);
+
+    /*!
+     * \brief Formats every metric in the Prometheus text format
+     * \return text of the metrics
+     * */
+    std::string ToPrometheusText() const;
+
+    /*!
+     * \brief Writes the metrics to a file through a temporary file and a rename
+     * \param path - file name, e.g. /var/lib/node_exporter/planner.prom
+     * \return true if the file was written, false if else
+     * */
+    bool WriteTextFile(const std::string &path) const;
+
+    /*!
+     * \brief Starts rewriting the file at a fixed interval, stopping any previous dump
+     * \param path - file name
+     * \param interval - time between two writes
+     * */
+    void StartPeriodicDump(const std::string &path, const std::chrono::milliseconds &interval);
+
+    /*! \brief Stops the periodic dump after writing the file one last time */
+    void StopPeriodicDump();
+
+private:
+    /*!
+     * \struct Entry
+     * \brief Define a registered QueryMetrics with its labels
+     * */
+    struct Entry {
+        std::string engine, operation, robot;
+        QueryMetrics metrics;
+    };
+
+    /*! \brief Registered metrics, guarded by mutex_ */
+    std::vector<std::unique_ptr<Entry>> entries_;
+    mutable std::mutex mutex_;
+
+    /*! \brief Periodic dump thread and its stop signal */
+    std::thread dump_thread_;
+    std::mutex dump_mutex_;
+    std::condition_variable dump_wake_;
+    bool is_dump_stopping_ = false;
+};
+
+#endif // ENPM809Y_PROJECT_5_PLANNERMETRICS_H
@@ -0,0 +1,277 @@
+/*!
+ * \file        PlannerServer.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file PlannerServer.h contains the header declarations for
+ *              PlannerServer class and its binary protocol. The class keeps a map
+ *              loaded and answers plan requests over a Unix domain socket.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_PLANNERSERVER_H
+#define ENPM809Y_PROJECT_5_PLANNERSERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "PlannerMetrics.h"
+#include "SnapshotStore.h"
+#include "TiledMap.h"
+#include "Wavefront.h"
+
+/*!
+ * \struct PlanRequest
+ * \brief Define the binary plan request sent by a client. Fields are in host byte
+ * order since both ends run on the same machine. mode is one of the kReply values.
+ * */
+struct PlanRequest {
+    std::uint32_t id = 0;
+    std::int32_t start_x = -1;
+    std::int32_t start_y = -1;
+    std::int32_t goal_x = -1;
+    std::int32_t goal_y = -1;
+    std::uint32_t mode = 0;
+};
+
+/*!
+ * \struct PlanReply
+ * \brief Define the header of the reply to a request. status is the number of moves,
+ * or -1 if no path exists, and version the map version the path was planned on (0 for
+ * a server on a fixed map). The header is followed by count entries: for kReplyPath
+ * a pair of int32 (x, y) per node from start to goal, for kReplyCommands one byte per
+ * move in execution order (the kCommand values, named like the BuildStack inputs).
+ * */
+struct PlanReply {
+    std::uint32_t id = 0;
+    std::int32_t status = -1;
+    std::uint32_t count = 0;
+    std::uint32_t mode = 0;
+    std::uint64_t version = 0;
+};
+
+/*! \brief Reply with the nodes of the path */
+const std::uint32_t kReplyPath = 0;
+
+/*! \brief Reply with the move commands of the path */
+const std::uint32_t kReplyCommands = 1;
+
+/*! \brief Move commands, the same moves as the "UP", "DOWN", "LEFT", "RIGHT" inputs */
+const std::uint8_t kCommandUp = 0;
+const std::uint8_t kCommandDown = 1;
+const std::uint8_t kCommandLeft = 2;
+const std::uint8_t kCommandRight = 3;
+
+/*!
+ * \class PlannerServer
+ * \brief The PlannerServer class loads the map once and serves plan requests from
+ * many clients over a Unix domain socket. Every time the socket wakes up, all the
+ * complete requests available from all clients form one batch. Requests of a batch
+ * which share a goal share one search: a wavefront distance map is grown from the goal
+ * and every start just walks down it. The distance maps of the most recent goals are
+ * kept, so repeated goals on a warm map cost one walk per request.
+ *
+ * A client is read at most kMaxInputBytes per wake up and not read at all while its
+ * unsent replies exceed the output limit, so a client which stops reading holds at most
+ * the replies of one read. It is dropped once its replies have not moved for the stall
+ * timeout.
+ *
+ * A server bound to a TiledMap searches the mapping in place, so the map is not copied
+ * into a grid and only its index and the tiles holding walls are read.
+ *
+ * A server bound to a SnapshotStore pins the current map version for each batch, so
+ * the map can be edited while requests are served; the distance maps are dropped when
+ * the version changes.
+ */
+class PlannerServer {
+public:
+    /*! \brief Bytes of requests read from a client per wake up */
+    static const std::size_t kMaxInputBytes = 64 * 1024;
+
+    /*!
+     * \brief Constructor binding the server to a map. The grid must outlive the server.
+     * \param grid - bit-packed free space
+     * \param cached_goals - number of goal distance maps kept between batches
+     * */
+    explicit PlannerServer(const BitGrid &grid, const int &cached_goals = 8);
+
+    /*!
+     * \brief Constructor binding the server to a mapped tiled map, which the searches
+     * read in place. The map must stay open while the server runs.
+     * \param map - opened tiled map
+     * \param cached_goals - number of goal distance maps kept between batches
+     * */
+    explicit PlannerServer(const TiledMap &map, const int &cached_goals = 8);
+
+    /*!
+     * \brief Constructor binding the server to a versioned map. The store must outlive
+     * the server.
+     * \param store - published map versions
+     * \param cached_goals - number of goal distance maps kept between batches
+     * */
+    explicit PlannerServer(const SnapshotStore &store, const int &cached_goals = 8);
+
+    /*! \brief Destructor closing the sockets */
+    ~PlannerServer();
+
+    PlannerServer(const PlannerServer &) = delete;
+    PlannerServer &operator=(const PlannerServer &) = delete;
+
+    /*!
+     * \brief Creates the listening socket, replacing a stale socket file
+     * \param socket_path - file system path of the socket
+     * \return true if the server is listening, false if else
+     * */
+    bool Listen(const std::string &socket_path);
+
+    /*! \brief Serves requests until Stop is called */
+    void Run();
+
+    /*! \brief Asks Run to return, safe to call from a signal handler */
+    void Stop();
+
+    /*!
+     * \brief Attaches a metrics registry. Every request records its latency within the
+     * batch, the cells its wavefront reached and its path length under engine
+     * "wavefront", as operation "single_goal" when it had its own search and
+     * "shared_goal" when it walked a shared distance map. Only the request which built a
+     * shared map counts its cells; the others walking it reached none.
+     * \param metrics - registry to record to, nullptr to stop recording
+     * */
+    void set_metrics(PlannerMetrics *metrics);
+
+    /*!
+     * \brief Sets the limits on slow clients, 4 MiB and 5 s by default
+     * \param max_output_bytes - unsent replies above which a client is not read
+     * \param stall_timeout - time without sending any reply after which a client is dropped
+     * */
+    void set_client_limits(const std::size_t &max_output_bytes, const std::chrono::milliseconds &stall_timeout);
+
+    /*! \brief Gets the number of requests answered so far */
+    std::uint64_t get_request_count() const { return request_count_; }
+
+    /*! \brief Gets the number of searches run so far */
+    std::uint64_t get_search_count() const { return search_count_; }
+
+    /*! \brief Gets the number of clients dropped for not reading their replies */
+    std::uint64_t get_dropped_count() const { return dropped_count_; }
+
+private:
+    /*!
+     * \struct Client
+     * \brief Define the state of a connected client: its socket, the bytes
+     * received but not parsed yet and produced but not sent yet, and when its output last
+     * started waiting or moved
+     * */
+    struct Client {
+        int fd = -1;
+        std::vector<char> input;
+        std::vector<char> output;
+        std::chrono::steady_clock::time_point last_progress;
+    };
+
+    /*!
+     * \struct Pending
+     * \brief Define a request waiting in the current batch with the client it came from
+     * and its goal cell, checked against the map when the batch starts
+     * */
+    struct Pending {
+        std::size_t client = 0;
+        PlanRequest request;
+        int goal = -1;
+    };
+
+    /*!
+     * \struct CachedGoal
+     * \brief Define a distance map kept for a goal and when it was last used
+     * */
+    struct CachedGoal {
+        int goal = -1;
+        std::uint64_t last_used = 0;
+        std::vector<int> distance;
+    };
+
+    /*! \brief Accepts all pending connections */
+    void Accept();
+
+    /*!
+     * \brief Reads what a client has sent and queues its complete requests
+     * \param client - index into clients_
+     * \return false if the client has disconnected
+     * */
+    bool Receive(const std::size_t &client);
+
+    /*! \brief Answers every queued request, one search per distinct goal */
+    void ProcessBatch();
+
+    /*!
+     * \brief Returns the distance map of a goal, from the cache or a new search
+     * \param goal - cell index of the goal
+     * \return distance map grown from the goal
+     * */
+    const std::vector<int> &DistanceFrom(const int &goal);
+
+    /*!
+     * \brief Appends the reply to a request to the output of its client
+     * \param pending - the request
+     * \param path - nodes from start to goal, empty if no path exists
+     * */
+    void Reply(const Pending &pending, const std::vector<std::pair<int, int>> &path);
+
+    /*!
+     * \brief Sends as much of the output of a client as the socket accepts
+     * \param client - index into clients_
+     * \return false if the client has disconnected
+     * */
+    bool Flush(const std::size_t &client);
+
+    /*! \brief Store of the map being served (nullptr for a fixed map) and its version */
+    const SnapshotStore *store_ = nullptr;
+    std::uint64_t version_ = 0;
+
+    /*! \brief Wavefront engine used for every search, which also checks the goals against
+     * the map, rebuilt when the version changes */
+    std::unique_ptr<Wavefront> wavefront_;
+
+    /*! \brief Listening socket and its path */
+    int listen_fd_ = -1;
+    std::string socket_path_;
+
+    /*! \brief Connected clients */
+    std::vector<Client> clients_;
+
+    /*! \brief Requests of the current batch */
+    std::vector<Pending> pending_;
+
+    /*! \brief Distance maps of recent goals */
+    std::vector<CachedGoal> cache_;
+
+    /*! \brief Number of distance maps kept */
+    std::size_t cached_goals_;
+
+    /*! \brief Scratch path reused by every reply */
+    std::vector<std::pair<int, int>> path_;
+
+    /*! \brief Counters of batches, requests, searches and dropped clients */
+    std::uint64_t batch_count_ = 0, request_count_ = 0, search_count_ = 0, dropped_count_ = 0;
+
+    /*! \brief Limits on slow clients */
+    std::size_t max_output_bytes_ = 4 * 1024 * 1024;
+    std::chrono::milliseconds stall_timeout_{5000};
+
+    /*! \brief Metrics of requests with their own search and with a shared one */
+    QueryMetrics *single_metrics_ = nullptr;
+    QueryMetrics *shared_metrics_ = nullptr;
+
+    /*! \brief Set by Stop */
+    std::atomic<bool> is_stopping_{false};
+};
+
+#endif // ENPM809Y_PROJECT_5_PLANNERSERVER_H
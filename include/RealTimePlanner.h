@@ -0,0 +1,198 @@
+/*!
+ * \file        RealTimePlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file RealTimePlanner.h contains the header declarations for
+ *              LearnedHeuristic and RealTimePlanner classes. They move a robot one
+ *              cell at a time after a search of bounded size.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_REALTIMEPLANNER_H
+#define ENPM809Y_PROJECT_5_REALTIMEPLANNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "MobileRobot.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \struct LearnedHeuristicHeader
+ * \brief Define the header stored at the start of a learned heuristic file. It is
+ * followed by entry_count entries of (goal cell, cell, value) as 32 bit words.
+ * */
+struct LearnedHeuristicHeader {
+    char magic[4] = {'M', 'Z', 'L', 'H'};
+    std::uint32_t version = 1;
+    std::uint32_t length = 0;
+    std::uint32_t width = 0;
+    std::uint32_t entry_count = 0;
+};
+
+/*!
+ * \class LearnedHeuristic
+ * \brief The LearnedHeuristic class keeps, for one map, the distances to go learned by
+ * real-time searches, per goal and cell. Only values above the Manhattan distance are
+ * stored, in a hash table, so the table grows with what the robots have learned and not
+ * with the map size. It outlives the missions, and can be saved and loaded with the map.
+ */
+class LearnedHeuristic {
+public:
+    /*!
+     * \brief Constructor for an empty table
+     * \param length - number of columns of the map
+     * \param width - number of rows of the map
+     * */
+    LearnedHeuristic(const int &length, const int &width) : length_{length}, width_{width} {}
+
+    /*! \brief Default destructor */
+    ~LearnedHeuristic() = default;
+
+    /*!
+     * \brief Distance to go from a cell to a goal
+     * \param goal - cell index of the goal
+     * \param cell - cell index
+     * \return learned value, at least the Manhattan distance
+     * */
+    int Get(const int &goal, const int &cell) const;
+
+    /*!
+     * \brief Raises the distance to go from a cell to a goal
+     * \param goal - cell index of the goal
+     * \param cell - cell index
+     * \param value - new value, ignored unless above the current one
+     * */
+    void Raise(const int &goal, const int &cell, const int &value);
+
+    /*! \brief Forgets every learned value, e.g. after the map has changed */
+    void Clear() { values_.clear(); }
+
+    /*!
+     * \brief Writes the table to a binary file
+     * \param path - file name
+     * \return true if the file was written, false if else
+     * */
+    bool Save(const std::string &path) const;
+
+    /*!
+     * \brief Reads a table from a binary file written for a map of the same size
+     * \param path - file name
+     * \return true if the table was loaded, false if else
+     * */
+    bool Load(const std::string &path);
+
+    /*! \brief Gets the number of learned values */
+    std::size_t get_entry_count() const { return values_.size(); }
+
+    /*! \brief Gets the size of the map */
+    int get_length() const { return length_; }
+    int get_width() const { return width_; }
+
+private:
+    /*! \brief Key of a value */
+    static std::uint64_t KeyOf(const int &goal, const int &cell) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(goal)) << 32) | static_cast<std::uint32_t>(cell);
+    }
+
+    /*! \brief Size of the map */
+    int length_, width_;
+
+    /*! \brief Learned values above the Manhattan distance */
+    std::unordered_map<std::uint64_t, int> values_;
+};
+
+/*!
+ * \class RealTimePlanner
+ * \brief The RealTimePlanner class moves a robot towards a goal right away, in the
+ * manner of Real-Time Adaptive A* (RTAA*). Every step runs A* from the robot with the
+ * learned heuristic, expanding at most the lookahead number of cells, takes the best
+ * cell of the frontier (the goal if it was reached), raises the heuristic of every
+ * expanded cell to the f value of that cell minus its own cost to come, and sends the
+ * robot the first move towards that cell with MobileRobot::Execute. The work of a step
+ * depends on the lookahead only, not on the map size, since the SearchWorkspace starts a
+ * query in constant time; only the first step and the growth of the learned table take
+ * longer.
+ *
+ * The learned values stay in the LearnedHeuristic, so later missions to the same goal
+ * wander less, and repeated missions converge to shortest paths. A goal that cannot be
+ * reached is detected when the frontier runs out or when the heuristic of the robot
+ * exceeds the number of cells of the map.
+ */
+class RealTimePlanner {
+public:
+    /*! \brief Results of a step */
+    static const int kNoPath = -1;
+    static const int kMoving = 0;
+    static const int kArrived = 1;
+
+    /*!
+     * \brief Constructor binding the planner to a map and its learned heuristic. Both
+     * must outlive the planner and have the same size.
+     * \param grid - bit-packed free space
+     * \param heuristic - learned values of the map, updated by every step
+     * \param lookahead - most cells expanded per step
+     * */
+    RealTimePlanner(const BitGrid &grid, LearnedHeuristic &heuristic, const int &lookahead = 64);
+
+    /*! \brief Default destructor */
+    ~RealTimePlanner() = default;
+
+    /*!
+     * \brief Starts a mission
+     * \param start - coordinate of the robot
+     * \param goal - coordinate of goal node
+     * \return kMoving, kArrived if the robot is on the goal, kNoPath if the start or the
+     * goal is blocked or outside the map
+     * */
+    int Start(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Searches around the robot, learns, and sends the robot one move
+     * \param robot - robot whose state machine executes the move as "UP", "DOWN", "LEFT"
+     * or "RIGHT"; its plan stack is left untouched
+     * \return kMoving after a move, kArrived once on the goal, kNoPath if the goal cannot
+     * be reached
+     * */
+    int Step(MobileRobot &robot);
+
+    /*! \brief Gets the coordinate of the robot */
+    std::pair<int, int> get_position() const {
+        return position_ < 0 ? std::make_pair(-1, -1) : grid_.ToNode(position_);
+    }
+
+    /*! \brief Gets the number of moves sent since Start */
+    int get_moves() const { return moves_; }
+
+    /*! \brief Gets the number of cells expanded by the last step */
+    int get_expansions() const { return expansions_; }
+
+private:
+    /*! \brief Map being searched and its learned heuristic */
+    const BitGrid &grid_;
+    LearnedHeuristic &heuristic_;
+
+    /*! \brief Most cells expanded per step */
+    int lookahead_;
+
+    /*! \brief Open list, costs and parents of the lookahead search */
+    SearchWorkspace workspace_;
+
+    /*! \brief Cells expanded by the current step */
+    std::vector<int> closed_;
+
+    /*! \brief Cell of the robot and of the goal, -1 before Start */
+    int position_ = -1, goal_ = -1;
+
+    /*! \brief State and statistics of the current mission */
+    int status_ = kNoPath, moves_ = 0, expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_REALTIMEPLANNER_H
@@ -36,7 +36,7 @@ namespace state {
          * \brief Push current node location into stack while update the new node
          * according to the previous move
          * */
-        void HandleInput(std::stack<RobotState *> &, const std::string &) override;
+        void HandleInput(StateStack &, const std::string &) override;
 
         /*! \brief Default destructor */
         ~RightState() override = default;
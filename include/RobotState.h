@@ -13,9 +13,12 @@
 #ifndef ENPM809Y_PROJECT_5_ROBOTSTATE_H
 #define ENPM809Y_PROJECT_5_ROBOTSTATE_H
 
+#include <cstddef>
+#include <deque>
 #include <iostream>
 #include <stack>
 #include <string>
+#include "AllocationCounter.h"
 
 /*!
  * \class RobotState
@@ -24,6 +27,11 @@
  * and a member to store the name of the state.
  */
 namespace state {
+    class RobotState;
+
+    /*! \brief Pushdown stack of the robot states, counted when allocation counting is on */
+    using StateStack = std::stack<RobotState *, std::deque<RobotState *, TrackedAllocator<RobotState *>>>;
+
     class RobotState {
     public:
         /*!
@@ -32,7 +40,7 @@ namespace state {
         \param string - sequence of move instruction
         \param stack - address of stack to gain access to the value while out of scope
         */
-        virtual void HandleInput(std::stack<RobotState *> &, const std::string &) = 0;
+        virtual void HandleInput(StateStack &, const std::string &) = 0;
 
         /*!
          * \brief Default constructor for RobotState class
@@ -51,6 +59,20 @@ namespace state {
          * */
         std::string get_name() { return name_; }
 
+#ifdef MAZE_ALLOCATION_COUNTING
+        /*! \brief Allocates a state, counted by AllocationCounter */
+        static void *operator new(std::size_t size) {
+            AllocationCounter::CountAllocation(size);
+            return ::operator new(size);
+        }
+
+        /*! \brief Frees a state, counted by AllocationCounter */
+        static void operator delete(void *pointer, std::size_t size) {
+            AllocationCounter::CountDeallocation(size);
+            ::operator delete(pointer);
+        }
+#endif
+
     private:
         /*! \brief Define the storage for name of RobotState */
         std::string name_;
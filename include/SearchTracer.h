@@ -0,0 +1,227 @@
+/*!
+ * \file        SearchTracer.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file SearchTracer.h contains the header declarations for
+ *              SearchTracer class and the tracing macros. The class records what a
+ *              search did and exports it for profiling.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_SEARCHTRACER_H
+#define ENPM809Y_PROJECT_5_SEARCHTRACER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class BitGrid;
+
+/*!
+ * \struct TraceRecord
+ * \brief Define one 32 byte entry of the trace: when it happened (nanoseconds since the
+ * tracer was created), its kind and phase, and for node events the cell index, the cost
+ * to come, the heuristic and the open list size
+ * */
+struct TraceRecord {
+    std::uint64_t time = 0;
+    std::int32_t cell = -1;
+    std::uint32_t open_size = 0;
+    float cost_g = 0;
+    float cost_h = 0;
+    std::uint8_t kind = 0;
+    std::uint8_t phase = 0;
+    std::uint16_t reserved = 0;
+    std::uint32_t padding = 0;
+};
+
+/*!
+ * \class SearchTracer
+ * \brief The SearchTracer class keeps the latest records of a search in a ring buffer
+ * of fixed size: recording is one clock read and one 32 byte store, and never
+ * allocates. The records are node expansions, node generations and the begin and end
+ * of phases (search, path reconstruction). The buffer can be saved in binary form and
+ * exported to Chrome trace event JSON (chrome://tracing or Perfetto) or to a text dump
+ * of animation frames showing the expansion order on the map.
+ *
+ * The hooks in the planners use the MAZE_TRACE macros, which only exist when the
+ * project is configured with -DMAZE_ENABLE_TRACING=ON; otherwise they compile to
+ * nothing. Even then a planner only records once a tracer is attached to it.
+ */
+class SearchTracer {
+public:
+    /*! \brief Record kinds */
+    static const std::uint8_t kExpand = 0;
+    static const std::uint8_t kGenerate = 1;
+    static const std::uint8_t kPhaseBegin = 2;
+    static const std::uint8_t kPhaseEnd = 3;
+
+    /*! \brief Phases */
+    static const std::uint8_t kPhaseSearch = 0;
+    static const std::uint8_t kPhaseReconstruct = 1;
+
+    /*!
+     * \brief Constructor allocating the ring buffer
+     * \param capacity - number of records kept, rounded up to a power of two
+     * */
+    explicit SearchTracer(const std::size_t &capacity = std::size_t{1} << 16);
+
+    /*! \brief Default destructor */
+    ~SearchTracer() = default;
+
+    /*!
+     * \brief Records a node expansion
+     * \param cell - cell index y * length + x
+     * \param cost_g - cost to come
+     * \param cost_h - heuristic
+     * \param open_size - open list size after the node was taken out
+     * */
+    void Expand(const int &cell, const double &cost_g, const double &cost_h, const std::size_t &open_size) {
+        Record(kExpand, phase_, cell, cost_g, cost_h, open_size);
+    }
+
+    /*!
+     * \brief Records a node pushed into the open list
+     * \param cell - cell index y * length + x
+     * \param cost_g - cost to come
+     * \param cost_h - heuristic
+     * \param open_size - open list size after the push
+     * */
+    void Generate(const int &cell, const double &cost_g, const double &cost_h, const std::size_t &open_size) {
+        Record(kGenerate, phase_, cell, cost_g, cost_h, open_size);
+    }
+
+    /*! \brief Records the beginning of a phase */
+    void BeginPhase(const std::uint8_t &phase) {
+        phase_ = phase;
+        Record(kPhaseBegin, phase, -1, 0, 0, 0);
+    }
+
+    /*! \brief Records the end of a phase */
+    void EndPhase(const std::uint8_t &phase) { Record(kPhaseEnd, phase, -1, 0, 0, 0); }
+
+    /*! \brief Forgets every record */
+    void Clear() { head_ = 0; }
+
+    /*!
+     * \brief Copies the records still in the buffer, oldest first
+     * \param records - output
+     * */
+    void Snapshot(std::vector<TraceRecord> &records) const;
+
+    /*!
+     * \brief Writes the records still in the buffer to a binary file, oldest first
+     * \param path - file name
+     * \return true if the file was written, false if else
+     * */
+    bool Save(const std::string &path) const;
+
+    /*!
+     * \brief Reads a binary file written by Save, replacing the records
+     * \param path - file name
+     * \return true if the file was read, false if else
+     * */
+    bool Load(const std::string &path);
+
+    /*!
+     * \brief Writes the records as Chrome trace event JSON: phases as duration events,
+     * node events as instant events and the open list size as a counter
+     * \param path - file name
+     * \param length - length of the map, to turn cell indices into x and y
+     * \return true if the file was written, false if else
+     * */
+    bool ExportChromeTrace(const std::string &path, const int &length) const;
+
+    /*!
+     * \brief Writes the map once every given number of expansions, with the expanded
+     * cells as '.' and the open cells as 'o', printed like Maze::ShowMaze
+     * \param path - file name
+     * \param grid - map the search ran on
+     * \param expansions_per_frame - expansions between two frames
+     * \return true if the file was written, false if else
+     * */
+    bool ExportFrames(const std::string &path, const BitGrid &grid, const int &expansions_per_frame) const;
+
+    /*! \brief Gets the number of records made, including the overwritten ones */
+    std::uint64_t get_record_count() const { return head_; }
+
+    /*! \brief Gets the capacity of the ring buffer */
+    std::size_t get_capacity() const { return records_.size(); }
+
+private:
+    /*! \brief Appends a record, overwriting the oldest one when the buffer is full */
+    void Record(const std::uint8_t &kind, const std::uint8_t &phase, const int &cell,
+                const double &cost_g, const double &cost_h, const std::size_t &open_size) {
+        TraceRecord &record = records_[head_++ & mask_];
+        record.time = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - origin_).count());
+        record.cell = cell;
+        record.open_size = static_cast<std::uint32_t>(open_size);
+        record.cost_g = static_cast<float>(cost_g);
+        record.cost_h = static_cast<float>(cost_h);
+        record.kind = kind;
+        record.phase = phase;
+    }
+
+    /*! \brief Ring buffer and its index mask */
+    std::vector<TraceRecord> records_;
+    std::size_t mask_ = 0;
+
+    /*! \brief Number of records made */
+    std::uint64_t head_ = 0;
+
+    /*! \brief Phase of the node events */
+    std::uint8_t phase_ = kPhaseSearch;
+
+    /*! \brief Time origin of the records */
+    std::chrono::steady_clock::time_point origin_;
+};
+
+/*!
+ * \class TraceSpan
+ * \brief The TraceSpan class records a phase for the lifetime of a scope, whatever way
+ * the scope is left
+ */
+class TraceSpan {
+public:
+    /*!
+     * \brief Constructor beginning the phase
+     * \param tracer - tracer to record to, nothing is recorded if null
+     * \param phase - phase
+     * */
+    TraceSpan(SearchTracer *tracer, const std::uint8_t &phase) : tracer_{tracer}, phase_{phase} {
+        if (tracer_ != nullptr)
+            tracer_->BeginPhase(phase_);
+    }
+
+    /*! \brief Destructor ending the phase */
+    ~TraceSpan() {
+        if (tracer_ != nullptr)
+            tracer_->EndPhase(phase_);
+    }
+
+    TraceSpan(const TraceSpan &) = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+private:
+    /*! \brief Tracer recorded to and phase of the span */
+    SearchTracer *tracer_;
+    std::uint8_t phase_;
+};
+
+#ifdef MAZE_TRACING
+/*! \brief Calls a SearchTracer method if a tracer is attached */
+#define MAZE_TRACE(tracer, call) do { if ((tracer) != nullptr) (tracer)->call; } while (0)
+/*! \brief Records a phase until the end of the enclosing scope */
+#define MAZE_TRACE_SPAN(tracer, phase) TraceSpan maze_trace_span_(tracer, phase)
+#else
+#define MAZE_TRACE(tracer, call) do {} while (0)
+#define MAZE_TRACE_SPAN(tracer, phase) do {} while (0)
+#endif
+
+#endif // ENPM809Y_PROJECT_5_SEARCHTRACER_H
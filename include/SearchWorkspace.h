@@ -0,0 +1,155 @@
+/*!
+ * \file        SearchWorkspace.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file SearchWorkspace.h contains the header declarations for
+ *              SearchWorkspace class. The class holds the per-state bookkeeping and
+ *              the open list of a best first search so that it can be reused.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_SEARCHWORKSPACE_H
+#define ENPM809Y_PROJECT_5_SEARCHWORKSPACE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "AllocationCounter.h"
+
+/*!
+ * \struct HeapEntry
+ * \brief Define data structure for an entry of the open list: its priority (total
+ * cost), an insertion sequence number so that ties pop in insertion order, and the
+ * state it refers to
+ * */
+struct HeapEntry {
+    double priority = 0;
+    std::uint64_t sequence = 0;
+    int state = -1;
+};
+
+/*!
+ * \class SearchWorkspace
+ * \brief The SearchWorkspace class replaces the open, closed and priority lists of a
+ * search with flat arrays indexed by state (e.g. y * length + x). A state is valid for
+ * the current query only if its stamp equals the current epoch, so starting a new
+ * query just increments the epoch, and memory that the query does not visit is never
+ * touched. The open list is a binary heap kept in a vector whose capacity survives
+ * between queries, so once the workspace has grown to the map size, planning does no
+ * heap allocation at all. Outdated heap entries are skipped when popped.
+ */
+class SearchWorkspace {
+public:
+    /*! \brief Default constructor for an empty workspace */
+    SearchWorkspace() = default;
+
+    /*! \brief Default destructor */
+    ~SearchWorkspace() = default;
+
+    /*!
+     * \brief Workspace of the calling thread, shared by all searches of that thread
+     * \return reference to the thread local workspace
+     * */
+    static SearchWorkspace &Local();
+
+    /*!
+     * \brief Starts a new query. The arrays only grow when the state count exceeds
+     * every previous query.
+     * \param states - number of states of the search space
+     * */
+    void Reset(const std::size_t &states);
+
+    /*!
+     * \brief Invalidates the closed marks only, keeping costs and parents. Used by
+     * searches which run several passes over the same costs.
+     * */
+    void ReopenAll();
+
+    /*! \brief Checks if a state has been reached in the current query */
+    bool IsSeen(const int &state) const { return seen_[state] == epoch_; }
+
+    /*! \brief Checks if a state has been expanded in the current pass */
+    bool IsClosed(const int &state) const { return closed_[state] == closed_epoch_; }
+
+    /*! \brief Marks a state as expanded */
+    void Close(const int &state) { closed_[state] = closed_epoch_; }
+
+    /*!
+     * \brief Cost to come of a state
+     * \param state - state index
+     * \return cost of the state, infinity if it has not been reached
+     * */
+    double get_cost(const int &state) const {
+        return IsSeen(state) ? cost_[state] : std::numeric_limits<double>::infinity();
+    }
+
+    /*! \brief Parent of a reached state */
+    int get_parent(const int &state) const { return parent_[state]; }
+
+    /*!
+     * \brief Records the cost to come and the parent of a state
+     * \param state - state index
+     * \param cost - cost to come
+     * \param parent - parent state index
+     * */
+    void Update(const int &state, const double &cost, const int &parent) {
+        seen_[state] = epoch_;
+        cost_[state] = cost;
+        parent_[state] = parent;
+    }
+
+    /*!
+     * \brief Pushes a state into the open list
+     * \param priority - total cost of the state
+     * \param state - state index
+     * */
+    void Push(const double &priority, const int &state);
+
+    /*!
+     * \brief Removes the entry with the lowest priority from the open list
+     * \return the removed entry
+     * */
+    HeapEntry Pop();
+
+    /*! \brief Lowest priority entry of the open list */
+    const HeapEntry &Top() const { return heap_.front(); }
+
+    /*! \brief Checks if the open list is empty */
+    bool IsEmpty() const { return heap_.empty(); }
+
+    /*! \brief Gets the number of entries in the open list */
+    std::size_t get_open_size() const { return heap_.size(); }
+
+    /*! \brief Removes every entry of the open list, keeping its storage */
+    void ClearOpen() { heap_.clear(); }
+
+private:
+    /*! \brief Checks if entry a must be popped before entry b */
+    static bool IsBefore(const HeapEntry &a, const HeapEntry &b) {
+        return a.priority < b.priority || (a.priority == b.priority && a.sequence < b.sequence);
+    }
+
+    /*! \brief Epoch stamps telling which states are reached and which are closed */
+    std::vector<std::uint32_t, TrackedAllocator<std::uint32_t>> seen_, closed_;
+
+    /*! \brief Cost to come of every state */
+    std::vector<double, TrackedAllocator<double>> cost_;
+
+    /*! \brief Parent of every state */
+    std::vector<int, TrackedAllocator<int>> parent_;
+
+    /*! \brief Current epochs of the seen and closed stamps */
+    std::uint32_t epoch_ = 0, closed_epoch_ = 0;
+
+    /*! \brief Insertion counter for the heap entries */
+    std::uint64_t sequence_ = 0;
+
+    /*! \brief Binary heap of the open list */
+    std::vector<HeapEntry, TrackedAllocator<HeapEntry>> heap_;
+};
+
+#endif // ENPM809Y_PROJECT_5_SEARCHWORKSPACE_H
@@ -0,0 +1,206 @@
+/*!
+ * \file        ShardedPlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file ShardedPlanner.h contains the header declarations for
+ *              ShardedPlanner class. The class splits a site-scale map between
+ *              worker processes which share their results through shared memory.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_SHARDEDPLANNER_H
+#define ENPM809Y_PROJECT_5_SHARDEDPLANNER_H
+
+#include <semaphore.h>
+#include <sys/types.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Path.h"
+#include "TiledMap.h"
+
+/*!
+ * \struct ShardTableHeader
+ * \brief Define the header of the shared memory segment a worker writes for a shard.
+ * It is followed by the cell index of every boundary node as 32 bit words, and by the
+ * boundary_count x boundary_count distances between them inside the shard, row by row,
+ * as 32 bit integers (-1 if one cannot be reached from the other inside the shard).
+ * */
+struct ShardTableHeader {
+    char magic[4] = {'M', 'Z', 'S', 'T'};
+    std::uint32_t version = 1;
+    std::uint32_t shard = 0;
+    std::uint32_t boundary_count = 0;
+};
+
+/*!
+ * \class ShardedPlanner
+ * \brief The ShardedPlanner class plans on a tiled map split into square shards, each
+ * owned by a worker process. The boundary nodes of a shard are its free cells next to a
+ * free cell of another shard. At Start every worker loads only its own shards from the
+ * map file, runs a BFS inside the shard from each boundary node, and writes the table of
+ * distances between boundary nodes into a POSIX shared memory segment, which the
+ * coordinator, the process calling Start, maps read only.
+ *
+ * A query asks the workers owning the shards of the start and of the goal for their
+ * distances to the boundary nodes, then the coordinator runs Dijkstra over the boundary
+ * nodes of all shards, joined by the tables inside a shard and by single moves across
+ * shards. Every shortest path crosses shards at boundary nodes only, so the result is a
+ * shortest path. The coordinator stitches it together by asking the owners of the
+ * shards it goes through for the cells of each part, the workers answering at the same
+ * time. Requests and replies go through a mailbox and a buffer per worker in a shared
+ * segment, signalled by process-shared semaphores.
+ *
+ * Workers own neighbouring shards, and can be pinned to CPUs spread over the CPUs the
+ * coordinator may run on, and so over the NUMA nodes. A worker touches its shards and
+ * tables first, so they are allocated on its own node. Start forks, so it must be called
+ * before the coordinator starts threads of its own.
+ */
+class ShardedPlanner {
+public:
+    /*! \brief Default side of a shard in cells */
+    static const int kDefaultShardSize = 256;
+
+    /*! \brief Default constructor for a stopped planner */
+    ShardedPlanner() = default;
+
+    /*! \brief Destructor stopping the workers */
+    ~ShardedPlanner();
+
+    ShardedPlanner(const ShardedPlanner &) = delete;
+    ShardedPlanner &operator=(const ShardedPlanner &) = delete;
+
+    /*!
+     * \brief Starts the workers on a map and waits until every table is written,
+     * stopping the previous workers
+     * \param path - file name of a tiled map
+     * \param workers - number of worker processes, 0 for one per hardware thread, at
+     * most one per shard
+     * \param shard_size - side of a shard in cells
+     * \param is_pinned - true to pin every worker to one CPU
+     * \return true if every worker has written its tables, false if else
+     * */
+    bool Start(const std::string &path, const int &workers = 0,
+               const int &shard_size = kDefaultShardSize, const bool &is_pinned = false);
+
+    /*! \brief Stops the workers and unmaps the tables */
+    void Stop();
+
+    /*!
+     * \brief Finds a shortest path
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, cleared if no path exists
+     * \return number of moves, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal, Path &path);
+
+    /*! \brief Gets the number of shards */
+    int get_shard_count() const { return shards_x_ * shards_y_; }
+
+    /*! \brief Gets the number of worker processes */
+    int get_worker_count() const { return static_cast<int>(pids_.size()); }
+
+    /*! \brief Gets the number of boundary nodes of all shards */
+    std::size_t get_boundary_count() const { return cells_.size(); }
+
+    /*! \brief Gets the size of the tables in shared memory in bytes */
+    std::size_t get_table_bytes() const;
+
+private:
+    /*!
+     * \struct Mailbox
+     * \brief Define the mailbox of a worker in the shared control segment: the
+     * semaphores posted by the coordinator and by the worker, and the request and result
+     * */
+    struct Mailbox {
+        sem_t request;
+        sem_t reply;
+        std::int32_t command;
+        std::int32_t shard;
+        std::int32_t from;
+        std::int32_t to;
+        std::int32_t result;
+    };
+
+    /*!
+     * \struct Part
+     * \brief Define a part of a path inside one shard, to be filled by its owner
+     * */
+    struct Part {
+        int shard;
+        int from;
+        int to;
+        std::vector<int> cells;
+    };
+
+    /*! \brief Runs a worker process until it is told to quit, never returns */
+    void RunWorker(const int &worker, const int &cpu);
+
+    /*! \brief Posts a request to a worker */
+    void Post(const int &worker, const int &command, const int &shard, const int &from, const int &to);
+
+    /*! \brief Waits for the reply of a worker, false if the worker has died */
+    bool Wait(const int &worker);
+
+    /*! \brief Reply buffer of a worker */
+    std::int32_t *BufferOf(const int &worker) const {
+        return buffers_ + static_cast<std::size_t>(worker) * buffer_cells_;
+    }
+
+    /*! \brief Shard of a cell */
+    int ShardOf(const int &cell) const {
+        return (cell / length_) / shard_size_ * shards_x_ + (cell % length_) / shard_size_;
+    }
+
+    /*! \brief Boundary node of a cell, -1 if it is not a boundary node */
+    int NodeOf(const int &cell) const;
+
+    /*! \brief Map, opened by the coordinator to check the queries */
+    TiledMap map_;
+
+    /*! \brief Name of the shared memory segments */
+    std::string name_;
+
+    /*! \brief Size of the map and of the shards */
+    int length_ = 0, width_ = 0, shard_size_ = kDefaultShardSize, shards_x_ = 0, shards_y_ = 0;
+
+    /*! \brief Worker processes, and worker owning every shard */
+    std::vector<pid_t> pids_;
+    std::vector<int> owners_;
+
+    /*! \brief Shared control segment: the mailboxes, then the reply buffers */
+    void *control_ = nullptr;
+    std::size_t control_bytes_ = 0;
+    Mailbox *mailboxes_ = nullptr;
+    std::int32_t *buffers_ = nullptr;
+    std::size_t buffer_cells_ = 0;
+
+    /*! \brief Table segment of every shard, its size, and the first boundary node of
+     * every shard, plus an end marker */
+    std::vector<const ShardTableHeader *> tables_;
+    std::vector<std::size_t> table_bytes_;
+    std::vector<int> first_node_;
+
+    /*! \brief Cell of every boundary node, sorted within a shard, and the moves to the
+     * boundary nodes of other shards, per node */
+    std::vector<std::uint32_t> cells_;
+    std::vector<std::uint32_t> first_cross_;
+    std::vector<int> cross_;
+
+    /*! \brief Scratch of a query: distance, parent and stamp of every node, the queue,
+     * the distances from the start and to the goal, and the parts of the path */
+    std::vector<int> distance_, parent_;
+    std::vector<std::uint32_t> stamp_;
+    std::vector<std::pair<int, int>> queue_;
+    std::uint32_t epoch_ = 0;
+    std::vector<int> from_start_, to_goal_;
+    std::vector<Part> parts_;
+};
+
+#endif // ENPM809Y_PROJECT_5_SHARDEDPLANNER_H
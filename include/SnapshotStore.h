@@ -0,0 +1,215 @@
+/*!
+ * \file        SnapshotStore.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file SnapshotStore.h contains the header declarations for
+ *              MapSnapshot and SnapshotStore classes. They let planners read a
+ *              consistent map without locks while the map is being edited.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_SNAPSHOTSTORE_H
+#define ENPM809Y_PROJECT_5_SNAPSHOTSTORE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+
+/*!
+ * \struct ObstacleUpdate
+ * \brief Define one edit of the map reported by a sensor: the cell and whether it
+ * becomes free or blocked
+ * */
+struct ObstacleUpdate {
+    std::int32_t x = -1;
+    std::int32_t y = -1;
+    bool is_free = false;
+};
+
+/*!
+ * \class MapSnapshot
+ * \brief The MapSnapshot class is one immutable version of the map. Versions are
+ * numbered from 1 in the order they were published.
+ */
+class MapSnapshot {
+public:
+    /*!
+     * \brief Constructor copying the map
+     * \param grid - free space of this version
+     * \param version - version number
+     * */
+    MapSnapshot(const BitGrid &grid, const std::uint64_t &version) : grid_{grid}, version_{version} {}
+
+    /*!
+     * \brief Constructor taking over an edited copy of the map
+     * \param grid - free space of this version, left empty
+     * \param version - version number
+     * */
+    MapSnapshot(BitGrid &&grid, const std::uint64_t &version) : grid_{std::move(grid)}, version_{version} {}
+
+    /*! \brief Gets the free space */
+    const BitGrid &get_grid() const { return grid_; }
+
+    /*! \brief Gets the version number */
+    std::uint64_t get_version() const { return version_; }
+
+private:
+    /*! \brief Free space and version number */
+    const BitGrid grid_;
+    const std::uint64_t version_;
+};
+
+/*!
+ * \class SnapshotStore
+ * \brief The SnapshotStore class publishes versions of the map read-copy-update style.
+ * The current version is an atomic pointer: a reader pins it with a Reader, which takes
+ * a hazard pointer slot, and then plans on it without any lock for as long as it likes.
+ *
+ * Writers queue obstacle updates with Submit, which only appends to a list, so sensors
+ * can report at any rate. Publish applies every queued update to a copy of the current
+ * map and swaps the copy in as the next version; the replaced version is retired and
+ * deleted as soon as no hazard pointer holds it. A publisher thread can call Publish at
+ * a fixed interval, so the cost of copying the map is paid once per interval whatever
+ * the number of updates.
+ */
+class SnapshotStore {
+public:
+    /*!
+     * \class Reader
+     * \brief The Reader class pins the current version for the lifetime of a scope. A
+     * Reader is not shared between threads.
+     */
+    class Reader {
+    public:
+        /*!
+         * \brief Constructor pinning the current version
+         * \param store - store to read
+         * */
+        explicit Reader(const SnapshotStore &store);
+
+        /*! \brief Destructor releasing the version */
+        ~Reader();
+
+        Reader(const Reader &) = delete;
+        Reader &operator=(const Reader &) = delete;
+
+        /*! \brief Version pinned */
+        const MapSnapshot &operator*() const { return *snapshot_; }
+        const MapSnapshot *operator->() const { return snapshot_; }
+
+    private:
+        /*! \brief Store read, hazard pointer slot taken and version pinned */
+        const SnapshotStore &store_;
+        std::size_t slot_;
+        const MapSnapshot *snapshot_;
+    };
+
+    /*! \brief Default number of hazard pointer slots, the readers pinning at once */
+    static const int kDefaultReaders = 64;
+
+    /*!
+     * \brief Constructor publishing the first version
+     * \param grid - free space of version 1
+     * \param readers - number of readers which may pin a version at the same time;
+     * more readers wait for a slot
+     * */
+    explicit SnapshotStore(const BitGrid &grid, const int &readers = kDefaultReaders);
+
+    /*! \brief Destructor stopping the publisher and deleting every version */
+    ~SnapshotStore();
+
+    SnapshotStore(const SnapshotStore &) = delete;
+    SnapshotStore &operator=(const SnapshotStore &) = delete;
+
+    /*!
+     * \brief Queues an update for the next version
+     * \param update - cell and new state
+     * */
+    void Submit(const ObstacleUpdate &update);
+
+    /*!
+     * \brief Queues updates for the next version
+     * \param updates - cells and new states, applied in order
+     * */
+    void Submit(const std::vector<ObstacleUpdate> &updates);
+
+    /*!
+     * \brief Publishes a version with every queued update. Nothing is published if no
+     * update changes the map.
+     * \return current version number
+     * */
+    std::uint64_t Publish();
+
+    /*!
+     * \brief Starts publishing at a fixed interval, stopping any previous publisher
+     * \param interval - time between two publications
+     * */
+    void StartPeriodicPublish(const std::chrono::milliseconds &interval);
+
+    /*! \brief Stops the publisher after publishing one last time */
+    void StopPeriodicPublish();
+
+    /*! \brief Gets the current version number */
+    std::uint64_t get_version() const { return current_.load()->get_version(); }
+
+    /*! \brief Gets the number of replaced versions not deleted yet */
+    std::size_t get_retired_count() const;
+
+private:
+    /*!
+     * \struct HazardSlot
+     * \brief Define a hazard pointer slot, alone on its cache line: whether a reader holds
+     * it and the version it protects
+     * */
+    struct alignas(64) HazardSlot {
+        /*! \brief Allocates slots on a cache line boundary, which plain new does not do
+         * for over-aligned types before C++17 */
+        static void *operator new[](std::size_t size);
+
+        /*! \brief Frees slots */
+        static void operator delete[](void *pointer);
+
+        std::atomic<const MapSnapshot *> pointer{nullptr};
+        std::atomic<bool> is_taken{false};
+    };
+
+    /*! \brief Takes a free slot, waiting if every slot is taken */
+    std::size_t Acquire() const;
+
+    /*! \brief Deletes the retired versions no slot protects, publish_mutex_ held */
+    void Reclaim();
+
+    /*! \brief Current version */
+    std::atomic<const MapSnapshot *> current_;
+
+    /*! \brief Hazard pointer slots */
+    std::unique_ptr<HazardSlot[]> slots_;
+    std::size_t slot_count_;
+
+    /*! \brief Replaced versions which may still be read, guarded by publish_mutex_ */
+    std::vector<const MapSnapshot *> retired_;
+    mutable std::mutex publish_mutex_;
+
+    /*! \brief Updates queued for the next version, guarded by queue_mutex_ */
+    std::vector<ObstacleUpdate> queued_;
+    std::mutex queue_mutex_;
+
+    /*! \brief Publisher thread and its stop signal */
+    std::thread publish_thread_;
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    bool is_stopping_ = false;
+};
+
+#endif // ENPM809Y_PROJECT_5_SNAPSHOTSTORE_H
@@ -21,6 +21,7 @@
 #include <map>
 #include "Maze.h"
 #include "MobileRobot.h"
+#include "Path.h"
 #include "WheeledRobot.h"
 #include "TrackedRobot.h"
 
@@ -98,6 +99,11 @@ private:
     /*! \brief Create a copy of Maze class for tracked robot*/
     Maze tracked_maze_;
 
+    /*! \brief Paths found for the wheeled and tracked robots, searched once and
+     * then plotted, executed and overlaid */
+    Path wheeled_path_;
+    Path tracked_path_;
+
     /*! \brief Character literal for plate*/
     char wheeled_target_ = 'p';
 
@@ -0,0 +1,79 @@
+/*!
+ * \file        TerrainPlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file TerrainPlanner.h contains the header declarations for
+ *              TerrainPlanner class. The class finds the cheapest path for a robot
+ *              type over a map with terrain costs.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_TERRAINPLANNER_H
+#define ENPM809Y_PROJECT_5_TERRAINPLANNER_H
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "BucketQueue.h"
+#include "CostMap.h"
+#include "MobileRobot.h"
+
+/*!
+ * \class TerrainPlanner
+ * \brief The TerrainPlanner class runs A* where a move costs the terrain cost of the
+ * cell entered, for the robot type of the query. The robot is asked for the cost of every
+ * terrain class once, when the query starts, and the search reads that 256 entry table,
+ * so no virtual call is made per node. Costs are integers, so the open list is a
+ * BucketQueue instead of a binary heap, and the heuristic is the Manhattan distance times
+ * the cheapest terrain cost of the robot. Costs to come and parents live in the
+ * SearchWorkspace of the calling thread. A path may cross no-stop cells but cannot end
+ * on one.
+ */
+class TerrainPlanner {
+public:
+    /*!
+     * \brief Constructor binding the planner to a map. Both must outlive the planner and
+     * have the same size.
+     * \param grid - bit-packed free space
+     * \param costs - terrain of every cell
+     * */
+    TerrainPlanner(const BitGrid &grid, const CostMap &costs);
+
+    /*! \brief Default destructor */
+    ~TerrainPlanner() = default;
+
+    /*!
+     * \brief Finds the cheapest path for a robot
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node, not on a no-stop cell
+     * \param robot - robot giving the terrain costs
+     * \param path - output, cells from start to goal (both included), as for Maze::BuildStack
+     * \return cost of the path, -1 if no path exists
+     * */
+    int FindPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                 const MobileRobot &robot, std::vector<std::pair<int, int>> &path);
+
+    /*! \brief Gets the number of cells expanded by the last query */
+    int get_expansions() const { return expansions_; }
+
+private:
+    /*! \brief Map being searched */
+    const BitGrid &grid_;
+    const CostMap &costs_;
+
+    /*! \brief Cost of entering each terrain class for the robot of the current query */
+    std::array<std::uint8_t, 256> table_{};
+
+    /*! \brief Open list, kept between queries */
+    BucketQueue open_;
+
+    /*! \brief Statistics of the last query */
+    int expansions_ = 0;
+};
+
+#endif // ENPM809Y_PROJECT_5_TERRAINPLANNER_H
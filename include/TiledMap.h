@@ -0,0 +1,153 @@
+/*!
+ * \file        TiledMap.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file TiledMap.h contains the header declarations for TiledMap
+ *              class. The class reads and writes the binary tiled map format and
+ *              gives the planners direct access to a memory-mapped map file.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_TILEDMAP_H
+#define ENPM809Y_PROJECT_5_TILEDMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include "BitGrid.h"
+
+/*!
+ * \struct TiledMapHeader
+ * \brief Define the header stored at the start of a tiled map file. All fields are
+ * little endian. The tile index follows the header, one 64 bit entry per tile in
+ * row-major tile order, holding either the byte offset of the tile in the file or
+ * one of the two markers for uniform tiles. The non-uniform tiles are stored after
+ * the index, page aligned, in Z-order (Morton order) of their tile coordinates.
+ * */
+struct TiledMapHeader {
+    char magic[4] = {'M', 'Z', 'T', 'M'};
+    std::uint32_t version = 1;
+    std::uint32_t length = 0;
+    std::uint32_t width = 0;
+    std::uint32_t tile_size = 64;
+    std::uint32_t tiles_x = 0;
+    std::uint32_t tiles_y = 0;
+    std::uint32_t stored_tiles = 0;
+    std::uint64_t index_offset = 0;
+    std::uint64_t data_offset = 0;
+};
+
+/*!
+ * \class TiledMap
+ * \brief The TiledMap class stores a map as 64x64 tiles of one bit per cell. A tile is
+ * 64 words of 64 bits (one word per tile row) which is 512 bytes, so a 4 kB page holds
+ * a 2x4 neighbourhood of tiles thanks to the Morton order, and a spatially local search
+ * only touches a few pages. Tiles which are entirely free or entirely blocked are not
+ * stored at all. The file is opened with mmap, so opening costs a few system calls
+ * whatever the size of the map, and pages are loaded by the kernel on first access.
+ */
+class TiledMap {
+public:
+    /*! \brief Tile index marker for a tile in which every cell is blocked */
+    static const std::uint64_t kAllBlocked = 0;
+
+    /*! \brief Tile index marker for a tile in which every cell is free */
+    static const std::uint64_t kAllFree = 1;
+
+    /*! \brief Default constructor for a closed map */
+    TiledMap() = default;
+
+    /*! \brief Destructor unmapping the file */
+    ~TiledMap();
+
+    TiledMap(const TiledMap &) = delete;
+    TiledMap &operator=(const TiledMap &) = delete;
+
+    /*!
+     * \brief Writes a grid to a tiled map file
+     * \param grid - free space to be written
+     * \param path - file name
+     * \return true if the file was written, false if else
+     * */
+    static bool Save(const BitGrid &grid, const std::string &path);
+
+    /*!
+     * \brief Maps a tiled map file into memory, closing the previous one
+     * \param path - file name
+     * \return true if the file is a valid map, false if else
+     * */
+    bool Open(const std::string &path);
+
+    /*! \brief Unmaps the file */
+    void Close();
+
+    /*!
+     * \brief Checks if given node is not an obstacle
+     * \param node - coordinate of node to be checked
+     * \return false if the node is a wall, true if else
+     * */
+    bool IsNotObstacle(const std::pair<int, int> &node) const {
+        const std::uint64_t entry = index_[(node.second >> 6) * header_->tiles_x + (node.first >> 6)];
+        if (entry <= kAllFree)
+            return entry == kAllFree;
+        const std::uint64_t row = *reinterpret_cast<const std::uint64_t *>(
+                base_ + entry + static_cast<std::size_t>(node.second & 63) * sizeof(std::uint64_t));
+        return ((row >> (node.first & 63)) & 1u) != 0;
+    }
+
+    /*!
+     * \brief Checks if given node is within the map
+     * \param node - coordinate of node to be checked
+     * \return true if the node is within the map, false if else
+     * */
+    bool IsWithinRegion(const std::pair<int, int> &node) const {
+        return node.first >= 0 && node.first < get_length() &&
+               node.second >= 0 && node.second < get_width();
+    }
+
+    /*!
+     * \brief Retrieves the char value of the map at given coordinate (x,y), in the
+     * same convention as Maze::GetMazePosition
+     * \param x - x coordinate of node
+     * \param y - y coordinate of node
+     * \return '#' for a wall and ' ' for free space
+     * */
+    char GetMazePosition(const int &x, const int &y) const {
+        return IsNotObstacle(std::make_pair(x, y)) ? ' ' : '#';
+    }
+
+    /*!
+     * \brief Copies the map into a BitGrid for the planners which work on rows
+     * \param grid - output grid, resized to the map
+     * */
+    void CopyTo(BitGrid &grid) const;
+
+    /*! \brief Checks if a file is currently mapped */
+    bool is_open() const { return base_ != nullptr; }
+
+    /*! \brief Gets the length (number of columns) of the map */
+    int get_length() const { return static_cast<int>(header_->length); }
+
+    /*! \brief Gets the width (number of rows) of the map */
+    int get_width() const { return static_cast<int>(header_->width); }
+
+    /*! \brief Gets the number of tiles stored explicitly in the file */
+    int get_stored_tiles() const { return static_cast<int>(header_->stored_tiles); }
+
+private:
+    /*! \brief Start of the mapping */
+    const unsigned char *base_ = nullptr;
+
+    /*! \brief Size of the mapping in bytes */
+    std::size_t size_ = 0;
+
+    /*! \brief Header and tile index inside the mapping */
+    const TiledMapHeader *header_ = nullptr;
+    const std::uint64_t *index_ = nullptr;
+};
+
+#endif // ENPM809Y_PROJECT_5_TILEDMAP_H
@@ -0,0 +1,121 @@
+/*!
+ * \file        TourPlanner.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file TourPlanner.h contains the header declarations for TourPlanner
+ *              class. The class orders the stops of a trip and joins them into one path.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_TOURPLANNER_H
+#define ENPM809Y_PROJECT_5_TOURPLANNER_H
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "Path.h"
+#include "SearchWorkspace.h"
+
+/*!
+ * \class TourPlanner
+ * \brief The TourPlanner class plans a trip from a start through several stops, e.g. the
+ * pickup and drop targets of a robot, in the order which takes the fewest moves. First
+ * it runs one BFS from the start and from each stop, stopped as soon as the points after
+ * it are reached, which gives the matrix of the distances between all points along the
+ * map (the moves being reversible, the distance from a later point is the same).
+ *
+ * The order is exact for up to kExactStops stops, by dynamic programming over the sets
+ * of stops visited (Held-Karp). For more stops it starts from the nearest neighbour
+ * order and improves it with 2-opt, which reverses a run of stops, and Or-opt, which
+ * moves a run of up to three stops elsewhere, until neither shortens the trip. The legs
+ * are then searched again one by one and joined into a single path, to be given to
+ * Maze::BuildStack as one command sequence.
+ */
+class TourPlanner {
+public:
+    /*! \brief Largest number of stops ordered exactly */
+    static const int kExactStops = 15;
+
+    /*!
+     * \brief Constructor binding the planner to a map. The grid must outlive the planner.
+     * \param grid - bit-packed free space
+     * */
+    explicit TourPlanner(const BitGrid &grid) : grid_{grid} {}
+
+    /*! \brief Default destructor */
+    ~TourPlanner() = default;
+
+    /*!
+     * \brief Plans a trip through every stop
+     * \param start - coordinate of the robot
+     * \param stops - coordinates of the stops, in any order
+     * \param is_returning - true if the trip ends back at the start, false if it ends at
+     * the last stop
+     * \param path - output, from the start through every stop, cleared if a stop cannot
+     * be reached
+     * \return number of moves of the trip, -1 if a stop cannot be reached
+     * */
+    int Plan(const std::pair<int, int> &start, const std::vector<std::pair<int, int>> &stops,
+             const bool &is_returning, Path &path);
+
+    /*! \brief Gets the order of the last trip, as indices into its stops */
+    const std::vector<int> &get_order() const { return order_; }
+
+    /*!
+     * \brief Gets a distance of the last trip
+     * \param from - 0 for the start, i + 1 for stop i
+     * \param to - 0 for the start, i + 1 for stop i
+     * \return number of moves between the two points
+     * */
+    int get_distance(const int &from, const int &to) const { return distances_[from * points_ + to]; }
+
+private:
+    /*!
+     * \brief Fills the distance matrix
+     * \return -1, or a point which cannot be reached from the start
+     * */
+    int BuildMatrix();
+
+    /*! \brief Orders the stops by dynamic programming over the sets of stops */
+    void OrderExactly();
+
+    /*! \brief Orders the stops by nearest neighbour, 2-opt and Or-opt */
+    void OrderLocally();
+
+    /*! \brief Distance between two points of the sequence, 0 to the open end */
+    int Leg(const int &from, const int &to) const {
+        return from == points_ || to == points_ ? 0 : distances_[from * points_ + to];
+    }
+
+    /*! \brief Appends the cells of the path between two points, without the first one */
+    void AppendLeg(const int &from, const int &to, std::vector<std::pair<int, int>> &nodes);
+
+    /*! \brief Map being searched */
+    const BitGrid &grid_;
+
+    /*! \brief Cells of the start and of the stops, and their number */
+    std::vector<int> cells_;
+    int points_ = 0;
+
+    /*! \brief Distances between the points, row by row */
+    std::vector<int> distances_;
+
+    /*! \brief Points in visiting order, the start first and the end last: the start
+     * again for a trip which returns, else the open end numbered points_ */
+    std::vector<int> sequence_;
+
+    /*! \brief Visiting order of the stops */
+    std::vector<int> order_;
+
+    /*! \brief Moves of the BFS to every cell */
+    std::vector<int> moves_;
+
+    /*! \brief Open list and parents of the leg searches */
+    SearchWorkspace workspace_;
+};
+
+#endif // ENPM809Y_PROJECT_5_TOURPLANNER_H
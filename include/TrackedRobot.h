@@ -30,8 +30,11 @@ public:
     /*! \brief Constructor to initialize the name as "Tracked Robot". */
     TrackedRobot() : MobileRobot("Tracked Robot") {};
 
-    /*! \brief Default destructor*/
-    ~TrackedRobot() = default;
+    /*! \brief Destructor freeing the states of the stack*/
+    ~TrackedRobot() override;
+
+    TrackedRobot(const TrackedRobot &) = delete;
+    TrackedRobot &operator=(const TrackedRobot &) = delete;
 
     /*!
      * \brief Virtual function to handle input.
@@ -42,11 +45,28 @@ public:
     /*! \brief Function to print the stack.*/
     void ShowStack() override;
 
+    /*!
+     * \brief Function to get the cost of turning in place by 90 degrees. Skid steering
+     * makes a turn take about three times as long as a move.
+     * \return cost of one turn
+     * */
+    double get_turn_cost() const override { return 3; }
+
+    /*!
+     * \brief Function to get the cost of moving into a cell of a given terrain. Tracks
+     * cross rough floor almost like flat floor, but climb ramps slowly.
+     * \param terrain - terrain class of the cell
+     * \return integer cost of the move, 0 if the robot cannot enter
+     * */
+    int get_terrain_cost(const std::uint8_t &terrain) const override {
+        return terrain == CostMap::kRough ? 2 : terrain == CostMap::kRamp ? 3 : MobileRobot::get_terrain_cost(terrain);
+    }
+
 private:
     /*! \brief Stack to store robot states for the
      * pushdown automata.
      * */
-    std::stack<state::RobotState *> robot_stack_;
+    state::StateStack robot_stack_;
 };
 
 #endif // ENPM809Y_PROJECT_5_TRACKEDROBOT_H
@@ -0,0 +1,201 @@
+/*!
+ * \file        Wavefront.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file Wavefront.h contains the header declarations for Wavefront
+ *              class. The class computes unit-cost distance maps with a bit-parallel
+ *              breadth first search over a BitGrid or a mapped TiledMap.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_WAVEFRONT_H
+#define ENPM809Y_PROJECT_5_WAVEFRONT_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "BitGrid.h"
+#include "TiledMap.h"
+
+/*!
+ * \class Wavefront
+ * \brief The Wavefront class advances a breadth first search one whole level at a
+ * time. The free space and the frontier are stored as 8x8 blocks, one 64 bit word
+ * per block, so the next level of a block is obtained with a handful of shifts
+ * (one bit for East/West, one row of 8 bits for North/South), masked with the free
+ * space and the cells not visited yet. Blocks keep the diagonal fronts of open maps
+ * compact, and only blocks next to the current frontier are touched. The blocks are
+ * read from a BitGrid, or from a mapped TiledMap in place, so a served map does not
+ * have to be copied into a grid first. Every step of
+ * the 4-connected maze costs 1, exactly like cost_g + 1 in Maze::Action, so the
+ * distances are the same as the A* path lengths while 64 cells are handled per
+ * instruction.
+ */
+class Wavefront {
+public:
+    /*!
+     * \brief Constructor binding the engine to a grid. The grid must outlive the engine.
+     * \param grid - bit-packed free space
+     * */
+    explicit Wavefront(const BitGrid &grid);
+
+    /*!
+     * \brief Constructor binding the engine to a mapped tiled map, read in place. The map
+     * must stay open while the engine is used.
+     * \param map - opened tiled map
+     * */
+    explicit Wavefront(const TiledMap &map);
+
+    /*! \brief Re-reads the free space after the grid has been modified */
+    void Refresh();
+
+    /*!
+     * \brief Checks if a node is within the map and free, as read at the last refresh
+     * \param node - coordinate of node to be checked
+     * \return true if the node can be searched from, false if else
+     * */
+    bool IsFree(const std::pair<int, int> &node) const {
+        return IsWithinRegion(node) &&
+               ((free_[BlockOf(node.first, node.second)] >> BitOf(node.first, node.second)) & 1u) != 0;
+    }
+
+    /*! \brief Converts a node to its row-major cell index y * length + x */
+    int ToIndex(const std::pair<int, int> &node) const { return node.second * length_ + node.first; }
+
+    /*! \brief Converts a row-major cell index back to a node */
+    std::pair<int, int> ToNode(const int &index) const { return std::make_pair(index % length_, index / length_); }
+
+    /*! \brief Default destructor */
+    ~Wavefront() = default;
+
+    /*!
+     * \brief Computes the single source distance map
+     * \param source - coordinate of the source node
+     * \param distance - output, one entry per cell (y * length + x), -1 if unreachable
+     * \return the largest distance found, -1 if the source is blocked
+     * */
+    int DistanceMap(const std::pair<int, int> &source, std::vector<int> &distance);
+
+    /*!
+     * \brief Computes the number of moves of a shortest path. The wavefront stops as
+     * soon as the goal level is reached and no distances are written.
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \return number of moves, -1 if no path exists
+     * */
+    int ShortestLength(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Checks if goal can be reached from start
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \return true if a path exists, false if else
+     * */
+    bool IsReachable(const std::pair<int, int> &start, const std::pair<int, int> &goal);
+
+    /*!
+     * \brief Finds a shortest path. The wavefront grows from the goal until it reaches
+     * the start, then the distances are walked down from the start.
+     * \param start - coordinate of start node
+     * \param goal - coordinate of goal node
+     * \param path - output, nodes from start to goal (both included)
+     * \return number of moves, -1 if no path exists
+     * */
+    int ShortestPath(const std::pair<int, int> &start, const std::pair<int, int> &goal,
+                     std::vector<std::pair<int, int>> &path);
+
+    /*!
+     * \brief Walks down a distance map from node to its source
+     * \param distance - distance map produced by DistanceMap
+     * \param node - coordinate of the node to start walking from
+     * \param path - output, nodes from node to the source of the map (both included)
+     * \return number of moves, -1 if node is not reachable in the map
+     * */
+    int Descend(const std::vector<int> &distance, const std::pair<int, int> &node,
+                std::vector<std::pair<int, int>> &path) const;
+
+    /*! \brief Gets the number of cells reached by the last wavefront, its source
+     * included, which is what a BFS would have expanded */
+    std::uint64_t get_reached() const { return reached_; }
+
+private:
+    /*!
+     * \brief Reads the free space of a map into the blocks
+     * \param grid - BitGrid or TiledMap
+     * */
+    template <typename Grid>
+    void Fill(const Grid &grid);
+
+    /*! \brief Checks if given node is within the map */
+    bool IsWithinRegion(const std::pair<int, int> &node) const {
+        return node.first >= 0 && node.first < length_ && node.second >= 0 && node.second < width_;
+    }
+
+    /*!
+     * \brief Seeds the frontier with the source node
+     * \param source - coordinate of the source node
+     * \return false if the source is outside the grid or blocked
+     * */
+    bool Seed(const std::pair<int, int> &source);
+
+    /*!
+     * \brief Advances the frontier by one level
+     * \param level - distance assigned to the new cells
+     * \param distance - distance map to fill, nullptr to skip writing distances
+     * \return false if no new cell was reached
+     * */
+    bool Advance(const int &level, std::vector<int> *distance);
+
+    /*!
+     * \brief Cells of a block reachable in one move from the current frontier
+     * \param block - block index
+     * \return mask of the reachable cells, before masking with the free space
+     * */
+    std::uint64_t Reach(const int &block) const;
+
+    /*!
+     * \brief Checks if node has been reached by the wavefront
+     * \param node - coordinate of node, must be within the grid
+     * \return true if the node is in the visited mask
+     * */
+    bool IsVisited(const std::pair<int, int> &node) const;
+
+    /*! \brief Index of the block holding cell (x,y) */
+    int BlockOf(const int &x, const int &y) const { return (y >> 3) * blocks_x_ + (x >> 3); }
+
+    /*! \brief Bit of cell (x,y) inside its block */
+    int BitOf(const int &x, const int &y) const { return ((y & 7) << 3) | (x & 7); }
+
+    /*! \brief Map being searched, a grid or a tiled map (the other one is nullptr) */
+    const BitGrid *grid_ = nullptr;
+    const TiledMap *map_ = nullptr;
+
+    /*! \brief Size of the map */
+    int length_, width_;
+
+    /*! \brief Number of 8x8 blocks along x and y */
+    int blocks_x_, blocks_y_;
+
+    /*! \brief Free space, current and next frontier and the visited mask, one word per block */
+    std::vector<std::uint64_t> free_, frontier_, next_, visited_;
+
+    /*! \brief Blocks holding the current and the next frontier */
+    std::vector<int> active_, next_active_;
+
+    /*! \brief Per block stamp so that every block is evaluated once per level */
+    std::vector<std::uint32_t> mark_;
+
+    /*! \brief Current stamp value */
+    std::uint32_t stamp_ = 0;
+
+    /*! \brief Cells reached by the last wavefront */
+    std::uint64_t reached_ = 0;
+
+    /*! \brief Distance buffer reused by ShortestPath */
+    std::vector<int> path_distance_;
+};
+
+#endif // ENPM809Y_PROJECT_5_WAVEFRONT_H
@@ -30,8 +30,11 @@ public:
     /*! @brief Constructor to initialize the name as "Wheeled Robot". */
     WheeledRobot() : MobileRobot("Wheeled Robot") {};
 
-    /*! @brief Default destructor*/
-    ~WheeledRobot() = default;
+    /*! @brief Destructor freeing the states of the stack*/
+    ~WheeledRobot() override;
+
+    WheeledRobot(const WheeledRobot &) = delete;
+    WheeledRobot &operator=(const WheeledRobot &) = delete;
 
     /*!
      * @brief Virtual function to handle input.
@@ -42,12 +45,29 @@ public:
     /*! @brief Function to print the stack.*/
     void ShowStack() override;
 
+    /*!
+     * @brief Function to get the cost of turning in place by 90 degrees. A differential
+     * drive turns in about half the time of a move.
+     * @return cost of one turn
+     * */
+    double get_turn_cost() const override { return 0.5; }
+
+    /*!
+     * @brief Function to get the cost of moving into a cell of a given terrain. Small
+     * wheels struggle on rough floor.
+     * @param terrain - terrain class of the cell
+     * @return integer cost of the move, 0 if the robot cannot enter
+     * */
+    int get_terrain_cost(const std::uint8_t &terrain) const override {
+        return terrain == CostMap::kRough ? 8 : MobileRobot::get_terrain_cost(terrain);
+    }
+
 private:
     /*!
      * @brief Stack to store robot states for the
      * pushdown automata.
      * */
-    std::stack<state::RobotState *> robot_stack_;
+    state::StateStack robot_stack_;
 };
 
 #endif // ENPM809Y_PROJECT_5_WHEELEDROBOT_H
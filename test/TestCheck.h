@@ -0,0 +1,34 @@
+/*!
+ * \file        TestCheck.h
+ * \author      Arun Kumar Devarajulu
+ * \author      Zuyang Cao
+ * \author      Qidi Xu
+ * \author      Hongyang Jiang
+ * \date        10/19/2026
+ * \brief       The file TestCheck.h contains the check macro shared by the test
+ *              programs, which are run by CTest and fail with a non-zero exit code.
+ * \license     This project is released under the MIT License.
+ */
+
+#ifndef ENPM809Y_PROJECT_5_TESTCHECK_H
+#define ENPM809Y_PROJECT_5_TESTCHECK_H
+
+#include <iostream>
+
+/*! \brief Number of failed checks of the test program */
+static int test_failures = 0;
+
+/*! \brief Checks a condition, printing it with its line if it does not hold */
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        if (!(condition)) {                                                                 \
+            std::cout << __FILE__ << ":" << __LINE__ << ": check failed: " #condition       \
+                      << std::endl;                                                         \
+            test_failures++;                                                                \
+        }                                                                                   \
+    } while (false)
+
+/*! \brief Exit code of the test program */
+#define TEST_RESULT() (test_failures == 0 ? 0 : 1)
+
+#endif // ENPM809Y_PROJECT_5_TESTCHECK_H
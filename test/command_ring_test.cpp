@@ -0,0 +1,167 @@
+/*
+ * @file        command_ring_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file command_ring_test.cpp tests the full, empty and close handshake of
+ *              CommandRing and the order in which CommandExecutor drives a robot
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/CommandRing.h"
+#include "../include/Maze.h"
+#include "../include/MobileRobot.h"
+#include "../include/Path.h"
+#include "../include/WheeledRobot.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief One thread fills and drains the ring to its limits */
+void TestSingleThread() {
+    CommandRing ring(5);
+    CHECK(ring.get_capacity() == 8);
+    std::uint8_t command = 0;
+    CHECK(!ring.TryPop(command));
+    for (std::uint8_t i = 0; i < 8; i++)
+        CHECK(ring.TryPush(i));
+    CHECK(!ring.TryPush(8));
+    for (std::uint8_t i = 0; i < 8; i++) {
+        CHECK(ring.TryPop(command));
+        CHECK(command == i);
+    }
+    CHECK(!ring.TryPop(command));
+    // Wrapping around, then closing with commands left: they are drained first
+    for (std::uint8_t i = 0; i < 3; i++)
+        CHECK(ring.TryPush(i));
+    ring.Close();
+    for (std::uint8_t i = 0; i < 3; i++) {
+        CHECK(ring.Pop(command));
+        CHECK(command == i);
+    }
+    CHECK(!ring.Pop(command));
+    ring.Reset();
+    CHECK(ring.TryPush(7));
+    CHECK(ring.Pop(command) && command == 7);
+}
+
+/*! \brief A producer much faster than the consumer fills a small ring many times */
+void TestHandshake() {
+    const std::uint32_t count = 200000;
+    CommandRing ring(16);
+    std::vector<std::uint8_t> received;
+    received.reserve(count);
+    std::thread consumer([&ring, &received]() {
+        std::uint8_t command;
+        while (ring.Pop(command))
+            received.push_back(command);
+    });
+    for (std::uint32_t i = 0; i < count; i++)
+        ring.Push(static_cast<std::uint8_t>(i % 251));
+    ring.Close();
+    consumer.join();
+    CHECK(received.size() == count);
+    bool is_in_order = received.size() == count;
+    for (std::uint32_t i = 0; is_in_order && i < count; i++)
+        is_in_order = received[i] == i % 251;
+    CHECK(is_in_order);
+}
+
+/*! \brief Input and state name of a move code */
+std::pair<std::string, std::string> MoveOf(const std::uint8_t &command) {
+    switch (command) {
+        case PathView::kUp:
+            return {"UP", "Up"};
+        case PathView::kDown:
+            return {"DOWN", "Down"};
+        case PathView::kLeft:
+            return {"LEFT", "Left"};
+        default:
+            return {"RIGHT", "Right"};
+    }
+}
+
+/*! \brief A streamed path takes the state machine from the start to the goal in as few
+ * moves as the path of Action, each move leaving the robot in the state of that move */
+void TestStreamOrder() {
+    Maze maze;
+    maze.SetStartGoal(1, 1, 44, 1);
+    Path path;
+    CHECK(maze.Action(path) == 1);
+    // A ring longer than the path holds the whole stream, which is executed by hand
+    CommandRing stream(256);
+    CHECK(maze.StreamStack(stream) == 1);
+    const auto robot = std::make_shared<WheeledRobot>();
+    CHECK(robot->get_state_name() == "Up");
+    // Ties may give another path than Action, so the moves are followed on the maze
+    std::pair<int, int> node{1, 1};
+    bool is_free = true, is_in_state = true;
+    std::uint8_t command;
+    std::string last_state;
+    while (stream.Pop(command)) {
+        const std::pair<std::string, std::string> move = MoveOf(command);
+        robot->Execute(move.first);
+        is_in_state = is_in_state && robot->get_state_name() == move.second;
+        last_state = move.second;
+        if (command == PathView::kUp)
+            node.second++;
+        else if (command == PathView::kDown)
+            node.second--;
+        else if (command == PathView::kLeft)
+            node.first--;
+        else
+            node.first++;
+        is_free = is_free && maze.IsNotObstacle(node);
+    }
+    CHECK(is_in_state);
+    CHECK(is_free);
+    CHECK(node == std::make_pair(44, 1));
+    CHECK(robot->get_executed_count() == path.get_move_count());
+    robot->Execute("JUMP");
+    CHECK(robot->get_executed_count() == path.get_move_count());
+    CHECK(robot->get_state_name() == last_state);
+    // The executor drives another robot through the same states, behind a small ring
+    CommandRing ring(4);
+    CommandExecutor executor(ring);
+    const auto driven = std::make_shared<WheeledRobot>();
+    executor.Start(driven);
+    CHECK(maze.StreamStack(ring) == 1);
+    CHECK(executor.Join() == path.get_move_count());
+    CHECK(driven->get_executed_count() == path.get_move_count());
+    CHECK(driven->get_state_name() == last_state);
+}
+
+}  // namespace
+
+int main() {
+    TestSingleThread();
+    TestHandshake();
+    TestStreamOrder();
+    return TEST_RESULT();
+}
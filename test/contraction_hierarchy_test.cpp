@@ -0,0 +1,122 @@
+/*
+ * @file        contraction_hierarchy_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file contraction_hierarchy_test.cpp checks the distances and paths of
+ *              contraction hierarchies against the wavefront, before and after a save and
+ *              load
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <unistd.h>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/ContractionHierarchy.h"
+#include "../include/MapGenerator.h"
+#include "../include/Path.h"
+#include "../include/Wavefront.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief Generates a layout with a wall across it, so that some cells cannot reach each other */
+BitGrid CutMap(const int &kind, const int &length, const int &width) {
+    MapOptions options;
+    options.length = length;
+    options.width = width;
+    options.seed = 11;
+    options.threads = 1;
+    BitGrid grid;
+    CHECK(MapGenerator(options).Generate(kind, grid));
+    for (int y = 0; y < width; y++)
+        grid.SetFree(length / 3, y, false);
+    return grid;
+}
+
+/*! \brief Compares the hierarchy with the wavefront from a few sources to every free cell */
+void CheckAgainstWavefront(const BitGrid &grid, ContractionHierarchy &hierarchy) {
+    Wavefront wavefront(grid);
+    std::vector<int> expected;
+    Path path;
+    for (int cell = 0; cell < grid.get_cell_count(); cell += grid.get_cell_count() / 7 + 1) {
+        std::pair<int, int> source = grid.ToNode(cell);
+        if (!grid.IsNotObstacle(source))
+            continue;
+        wavefront.DistanceMap(source, expected);
+        for (int goal_cell = 0; goal_cell < grid.get_cell_count(); goal_cell++) {
+            const std::pair<int, int> goal = grid.ToNode(goal_cell);
+            if (!grid.IsNotObstacle(goal))
+                continue;
+            CHECK(hierarchy.Distance(source, goal) == expected[goal_cell]);
+            CHECK(hierarchy.Distance(goal, source) == expected[goal_cell]);
+            // Unpacking is linear in the path, so only some of the paths are checked
+            if (goal_cell % 13 != 0)
+                continue;
+            CHECK(hierarchy.FindPath(source, goal, path) == expected[goal_cell]);
+            if (expected[goal_cell] < 0) {
+                CHECK(path.IsEmpty());
+                continue;
+            }
+            CHECK(static_cast<int>(path.get_move_count()) == expected[goal_cell]);
+            std::pair<int, int> last(-1, -1);
+            for (const auto &node : path.View()) {
+                CHECK(grid.IsNotObstacle(node));
+                last = node;
+            }
+            CHECK(path.View().get_start() == source && last == goal);
+        }
+    }
+    CHECK(hierarchy.Distance(std::make_pair(0, 0), std::make_pair(1, 1)) == -1);
+}
+
+/*! \brief Builds the hierarchy of a layout, checks it, and checks it again once saved and loaded */
+void TestLayout(const int &kind, const int &length, const int &width) {
+    const BitGrid grid = CutMap(kind, length, width);
+    ContractionHierarchy hierarchy;
+    hierarchy.Build(grid, 2);
+    CheckAgainstWavefront(grid, hierarchy);
+    const std::string file = "/tmp/contraction_hierarchy_test_" + std::to_string(getpid()) + ".ch";
+    CHECK(hierarchy.Save(file));
+    ContractionHierarchy loaded;
+    CHECK(loaded.Load(file, grid));
+    CHECK(loaded.get_arc_count() == hierarchy.get_arc_count());
+    CheckAgainstWavefront(grid, loaded);
+    // The hierarchy of a map does not match a changed map
+    BitGrid changed = grid;
+    changed.SetFree(length / 3, width / 2, true);
+    CHECK(!loaded.Load(file, changed));
+    std::remove(file.c_str());
+}
+
+}  // namespace
+
+int main() {
+    TestLayout(MapGenerator::kRooms, 120, 80);
+    TestLayout(MapGenerator::kWarehouse, 130, 70);
+    TestLayout(MapGenerator::kBraided, 91, 61);
+    TestLayout(MapGenerator::kPerfect, 61, 41);
+    return TEST_RESULT();
+}
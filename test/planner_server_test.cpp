@@ -0,0 +1,281 @@
+/*
+ * @file        planner_server_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file planner_server_test.cpp checks the replies of PlannerServer against a
+ *              breadth first search and that a client which stops reading is dropped
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Maze.h"
+#include "../include/PlannerMetrics.h"
+#include "../include/PlannerServer.h"
+#include "../include/TiledMap.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief Socket of the test server, one per process */
+std::string SocketPath() {
+    return "/tmp/planner_server_test_" + std::to_string(getpid()) + ".sock";
+}
+
+/*! \brief Connects to the test server, -1 on failure */
+int Connect() {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, SocketPath().c_str(), sizeof(address.sun_path) - 1);
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*! \brief Reads exactly size bytes, false on end of stream or time out */
+bool ReadAll(const int &fd, char *data, std::size_t size) {
+    while (size > 0) {
+        const ssize_t received = recv(fd, data, size, 0);
+        if (received <= 0)
+            return false;
+        data += received;
+        size -= static_cast<std::size_t>(received);
+    }
+    return true;
+}
+
+/*! \brief Moves from every cell to the goal, -1 where it cannot be reached */
+std::vector<int> Distances(const BitGrid &grid, const std::pair<int, int> &goal) {
+    std::vector<int> distance(static_cast<std::size_t>(grid.get_length()) * grid.get_width(), -1);
+    std::deque<std::pair<int, int>> open{goal};
+    distance[grid.ToIndex(goal)] = 0;
+    while (!open.empty()) {
+        const std::pair<int, int> node = open.front();
+        open.pop_front();
+        for (int k = 0; k < 4; k++) {
+            const std::pair<int, int> next(node.first + BitGrid::kMoveX[k], node.second + BitGrid::kMoveY[k]);
+            if (grid.IsWithinRegion(next) && grid.IsNotObstacle(next) && distance[grid.ToIndex(next)] < 0) {
+                distance[grid.ToIndex(next)] = distance[grid.ToIndex(node)] + 1;
+                open.push_back(next);
+            }
+        }
+    }
+    return distance;
+}
+
+/*! \brief Server of the default maze running on its own thread, serving the grid or the
+ * maze saved as a tiled map and read in place */
+struct RunningServer {
+    Maze maze;
+    BitGrid grid{maze};
+    std::string map_file;
+    TiledMap map;
+    std::unique_ptr<PlannerServer> server;
+    std::thread thread;
+
+    explicit RunningServer(const bool &is_tiled = false) {
+        if (!is_tiled) {
+            server.reset(new PlannerServer(grid));
+            return;
+        }
+        map_file = "/tmp/planner_server_test_" + std::to_string(getpid()) + ".tmap";
+        CHECK(TiledMap::Save(grid, map_file) && map.Open(map_file));
+        server.reset(new PlannerServer(map));
+    }
+
+    ~RunningServer() {
+        if (!map_file.empty())
+            std::remove(map_file.c_str());
+    }
+
+    bool Start() {
+        if (!server->Listen(SocketPath()))
+            return false;
+        thread = std::thread([this]() { server->Run(); });
+        return true;
+    }
+
+    void Stop() {
+        server->Stop();
+        thread.join();
+    }
+};
+
+/*! \brief Requests every start to every goal in one go, shared and lone goals mixed, and
+ * checks the length and the moves of each reply */
+void TestReplies(const bool &is_tiled) {
+    RunningServer running(is_tiled);
+    PlannerMetrics metrics;
+    running.server->set_metrics(&metrics);
+    CHECK(running.Start());
+    const BitGrid &grid = running.grid;
+    const std::vector<std::pair<int, int>> starts{{1, 1}, {44, 1}, {10, 10}, {28, 20}, {3, 29}};
+    const std::vector<std::pair<int, int>> goals{{44, 1}, {1, 1}, {28, 20}, {0, 0}};
+    std::vector<PlanRequest> requests;
+    for (const auto &goal : goals) {
+        for (const auto &start : starts) {
+            if (!grid.IsNotObstacle(start))
+                continue;
+            PlanRequest request;
+            request.id = static_cast<std::uint32_t>(requests.size());
+            request.start_x = start.first;
+            request.start_y = start.second;
+            request.goal_x = goal.first;
+            request.goal_y = goal.second;
+            request.mode = requests.size() % 2 == 0 ? kReplyPath : kReplyCommands;
+            requests.push_back(request);
+        }
+    }
+    // A lone goal gets its own search
+    PlanRequest lone = requests.front();
+    lone.id = static_cast<std::uint32_t>(requests.size());
+    lone.goal_x = 10;
+    lone.goal_y = 10;
+    requests.push_back(lone);
+    const int fd = Connect();
+    CHECK(fd >= 0);
+    CHECK(send(fd, requests.data(), requests.size() * sizeof(PlanRequest), 0) ==
+          static_cast<ssize_t>(requests.size() * sizeof(PlanRequest)));
+    std::vector<bool> is_answered(requests.size(), false);
+    for (std::size_t answered = 0; answered < requests.size(); answered++) {
+        PlanReply reply;
+        CHECK(ReadAll(fd, reinterpret_cast<char *>(&reply), sizeof(reply)));
+        CHECK(reply.id < requests.size() && !is_answered[reply.id]);
+        if (reply.id >= requests.size())
+            break;
+        is_answered[reply.id] = true;
+        const PlanRequest &request = requests[reply.id];
+        const std::pair<int, int> start(request.start_x, request.start_y), goal(request.goal_x, request.goal_y);
+        const int expected = grid.IsWithinRegion(goal) && grid.IsNotObstacle(goal)
+                             ? Distances(grid, goal)[grid.ToIndex(start)] : -1;
+        CHECK(reply.status == expected);
+        CHECK(reply.mode == request.mode);
+        // Walk the reply from the start, checking every node is free and next to the last
+        std::pair<int, int> node = start;
+        bool is_valid = true;
+        if (reply.mode == kReplyPath) {
+            CHECK(reply.count == (expected < 0 ? 0u : static_cast<std::uint32_t>(expected) + 1));
+            for (std::uint32_t i = 0; i < reply.count; i++) {
+                std::int32_t xy[2];
+                CHECK(ReadAll(fd, reinterpret_cast<char *>(xy), sizeof(xy)));
+                const int step = std::abs(xy[0] - node.first) + std::abs(xy[1] - node.second);
+                is_valid = is_valid && step == (i == 0 ? 0 : 1);
+                node = std::make_pair(xy[0], xy[1]);
+                is_valid = is_valid && grid.IsWithinRegion(node) && grid.IsNotObstacle(node);
+            }
+        } else {
+            CHECK(reply.count == (expected < 0 ? 0u : static_cast<std::uint32_t>(expected)));
+            for (std::uint32_t i = 0; i < reply.count; i++) {
+                char command;
+                CHECK(ReadAll(fd, &command, 1));
+                if (command == kCommandUp)
+                    node.second++;
+                else if (command == kCommandDown)
+                    node.second--;
+                else if (command == kCommandLeft)
+                    node.first--;
+                else if (command == kCommandRight)
+                    node.first++;
+                else
+                    is_valid = false;
+                is_valid = is_valid && grid.IsWithinRegion(node) && grid.IsNotObstacle(node);
+            }
+        }
+        CHECK(is_valid);
+        CHECK(expected < 0 || node == goal);
+    }
+    close(fd);
+    running.Stop();
+    CHECK(running.server->get_request_count() == requests.size());
+    const QueryMetrics &single = metrics.Get("wavefront", "single_goal", "any");
+    const QueryMetrics &shared = metrics.Get("wavefront", "shared_goal", "any");
+    CHECK(single.latency.get_count() + shared.latency.get_count() == requests.size());
+    CHECK(single.expansions.get_sum() > 0);
+    CHECK(shared.expansions.get_sum() > 0);
+}
+
+/*! \brief A client which sends many requests and never reads is dropped, while another
+ * client is still answered */
+void TestSlowClient() {
+    RunningServer running;
+    running.server->set_client_limits(4096, std::chrono::milliseconds(200));
+    CHECK(running.Start());
+    const int slow = Connect(), fast = Connect();
+    CHECK(slow >= 0 && fast >= 0);
+    PlanRequest request;
+    request.start_x = 1;
+    request.start_y = 1;
+    request.goal_x = 44;
+    request.goal_y = 1;
+    request.mode = kReplyPath;
+    const std::vector<PlanRequest> flood(4000, request);
+    CHECK(send(slow, flood.data(), flood.size() * sizeof(PlanRequest), MSG_DONTWAIT) > 0);
+    timeval timeout{10, 0};
+    setsockopt(slow, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fast, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(send(fast, &request, sizeof(request), 0) == static_cast<ssize_t>(sizeof(request)));
+    PlanReply reply;
+    CHECK(ReadAll(fast, reinterpret_cast<char *>(&reply), sizeof(reply)));
+    CHECK(reply.status > 0);
+    // Reading nothing for longer than the stall timeout, what was sent before the server
+    // dropped the client is then followed by the end of the stream
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    std::vector<char> buffer(1 << 16);
+    ssize_t received;
+    while ((received = recv(slow, buffer.data(), buffer.size(), 0)) > 0) {
+    }
+    // Requests left unread in the socket of the server turn the close into a reset
+    CHECK(received == 0 || (received < 0 && errno == ECONNRESET));
+    close(slow);
+    close(fast);
+    running.Stop();
+    CHECK(running.server->get_dropped_count() == 1);
+}
+
+} // namespace
+
+int main() {
+    TestReplies(false);
+    TestReplies(true);
+    TestSlowClient();
+    return TEST_RESULT();
+}
@@ -0,0 +1,119 @@
+/*
+ * @file        real_time_planner_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file real_time_planner_test.cpp checks that RealTimePlanner drives the state
+ *              machine of the robot one move per step and learns to reach the goal on shortest paths
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/Maze.h"
+#include "../include/RealTimePlanner.h"
+#include "../include/WheeledRobot.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief Moves from a cell to every cell, -1 where it cannot be reached */
+std::vector<int> Distances(const BitGrid &grid, const std::pair<int, int> &from) {
+    std::vector<int> distance(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    std::deque<std::pair<int, int>> open{from};
+    distance[grid.ToIndex(from)] = 0;
+    while (!open.empty()) {
+        const std::pair<int, int> node = open.front();
+        open.pop_front();
+        for (int k = 0; k < 4; k++) {
+            const std::pair<int, int> next(node.first + BitGrid::kMoveX[k], node.second + BitGrid::kMoveY[k]);
+            if (grid.IsWithinRegion(next) && grid.IsNotObstacle(next) && distance[grid.ToIndex(next)] < 0) {
+                distance[grid.ToIndex(next)] = distance[grid.ToIndex(node)] + 1;
+                open.push_back(next);
+            }
+        }
+    }
+    return distance;
+}
+
+/*! \brief State the robot is in after a move from one cell to the next */
+std::string StateOf(const std::pair<int, int> &from, const std::pair<int, int> &to) {
+    if (to.second == from.second + 1)
+        return "Up";
+    if (to.second == from.second - 1)
+        return "Down";
+    return to.first == from.first + 1 ? "Right" : "Left";
+}
+
+/*!
+ * \brief Runs a mission, checking after every step that the robot moved to a free
+ * neighbour and its state machine is in the state of that move
+ * \return number of moves, -1 if the mission failed
+ * */
+int RunMission(const BitGrid &grid, LearnedHeuristic &heuristic, const std::pair<int, int> &start,
+               const std::pair<int, int> &goal) {
+    RealTimePlanner planner(grid, heuristic, 8);
+    WheeledRobot robot;
+    if (planner.Start(start, goal) != RealTimePlanner::kMoving)
+        return -1;
+    bool is_valid = true;
+    int status = RealTimePlanner::kMoving;
+    for (int step = 0; status == RealTimePlanner::kMoving && step < 100000; step++) {
+        const std::pair<int, int> from = planner.get_position();
+        status = planner.Step(robot);
+        if (status == RealTimePlanner::kNoPath)
+            break;
+        const std::pair<int, int> to = planner.get_position();
+        is_valid = is_valid && std::abs(to.first - from.first) + std::abs(to.second - from.second) == 1 &&
+                   grid.IsNotObstacle(to) && robot.get_state_name() == StateOf(from, to);
+    }
+    CHECK(is_valid);
+    CHECK(status == RealTimePlanner::kArrived);
+    CHECK(planner.get_position() == goal);
+    CHECK(robot.get_executed_count() == static_cast<std::uint64_t>(planner.get_moves()));
+    return status == RealTimePlanner::kArrived ? planner.get_moves() : -1;
+}
+
+} // namespace
+
+int main() {
+    Maze maze;
+    const BitGrid grid(maze);
+    const std::pair<int, int> start{1, 1}, goal{44, 1};
+    const int shortest = Distances(grid, goal)[grid.ToIndex(start)];
+    CHECK(shortest > 0);
+    // Repeated missions to the same goal converge to a shortest path
+    LearnedHeuristic heuristic(grid.get_length(), grid.get_width());
+    int moves = -1;
+    for (int mission = 0; mission < 200 && moves != shortest; mission++)
+        moves = RunMission(grid, heuristic, start, goal);
+    CHECK(moves == shortest);
+    // A blocked goal is refused before any move
+    RealTimePlanner planner(grid, heuristic);
+    CHECK(planner.Start(start, {0, 0}) == RealTimePlanner::kNoPath);
+    return TEST_RESULT();
+}
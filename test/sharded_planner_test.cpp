@@ -0,0 +1,174 @@
+/*
+ * @file        sharded_planner_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file sharded_planner_test.cpp checks the paths of ShardedPlanner against a
+ *              breadth first search on small maps, and that its workers and segments go away
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <dirent.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/MapGenerator.h"
+#include "../include/Path.h"
+#include "../include/ShardedPlanner.h"
+#include "../include/TiledMap.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief Moves from a cell to every cell, -1 where it cannot be reached */
+std::vector<int> Distances(const BitGrid &grid, const std::pair<int, int> &from) {
+    std::vector<int> distance(static_cast<std::size_t>(grid.get_cell_count()), -1);
+    std::deque<std::pair<int, int>> open{from};
+    distance[grid.ToIndex(from)] = 0;
+    while (!open.empty()) {
+        const std::pair<int, int> node = open.front();
+        open.pop_front();
+        for (int k = 0; k < 4; k++) {
+            const std::pair<int, int> next(node.first + BitGrid::kMoveX[k], node.second + BitGrid::kMoveY[k]);
+            if (grid.IsWithinRegion(next) && grid.IsNotObstacle(next) && distance[grid.ToIndex(next)] < 0) {
+                distance[grid.ToIndex(next)] = distance[grid.ToIndex(node)] + 1;
+                open.push_back(next);
+            }
+        }
+    }
+    return distance;
+}
+
+/*! \brief Picks a random free node of a grid */
+std::pair<int, int> RandomFreeNode(const BitGrid &grid, std::mt19937_64 &random) {
+    std::uniform_int_distribution<int> x(0, grid.get_length() - 1), y(0, grid.get_width() - 1);
+    while (true) {
+        const std::pair<int, int> node(x(random), y(random));
+        if (grid.IsNotObstacle(node))
+            return node;
+    }
+}
+
+/*! \brief Number of shared memory segments left by the planners of this process */
+int SegmentsLeft() {
+    const std::string prefix = "maze_shards_" + std::to_string(getpid()) + "_";
+    int count = 0;
+    DIR *directory = opendir("/dev/shm");
+    if (directory == nullptr)
+        return 0;
+    while (const dirent *entry = readdir(directory)) {
+        if (std::string(entry->d_name).compare(0, prefix.size(), prefix) == 0)
+            count++;
+    }
+    closedir(directory);
+    return count;
+}
+
+/*! \brief Checks one query: its length against the BFS, and its path cell by cell */
+void CheckQuery(ShardedPlanner &planner, const BitGrid &grid, const std::pair<int, int> &start,
+                const std::pair<int, int> &goal, const int &expected) {
+    Path path;
+    const int moves = planner.FindPath(start, goal, path);
+    CHECK(moves == expected);
+    if (expected < 0) {
+        CHECK(path.IsEmpty());
+        return;
+    }
+    CHECK(!path.IsEmpty() && path.get_move_count() == static_cast<std::size_t>(expected));
+    bool is_valid = true;
+    std::size_t count = 0;
+    std::pair<int, int> last = start;
+    for (const auto &node : path.View()) {
+        const int step = std::abs(node.first - last.first) + std::abs(node.second - last.second);
+        is_valid = is_valid && step == (count == 0 ? 0 : 1) && grid.IsWithinRegion(node) && grid.IsNotObstacle(node);
+        last = node;
+        count++;
+    }
+    CHECK(is_valid);
+    CHECK(count == static_cast<std::size_t>(expected) + 1);
+    CHECK(last == goal);
+}
+
+/*!
+ * \brief Plans on a map with some shards and workers and compares random queries with
+ * a BFS
+ * \param file - tiled map file of the grid
+ * \param grid - the map
+ * \param workers - number of worker processes
+ * \param shard_size - side of a shard
+ * */
+void TestAgainstBfs(const std::string &file, const BitGrid &grid, const int &workers, const int &shard_size) {
+    ShardedPlanner planner;
+    CHECK(planner.Start(file, workers, shard_size));
+    const int shards_x = (grid.get_length() + shard_size - 1) / shard_size;
+    const int shards_y = (grid.get_width() + shard_size - 1) / shard_size;
+    CHECK(planner.get_shard_count() == shards_x * shards_y);
+    CHECK(planner.get_worker_count() == std::min(workers, shards_x * shards_y));
+    CHECK((planner.get_boundary_count() > 0) == (shards_x * shards_y > 1));
+    std::mt19937_64 random(static_cast<std::uint64_t>(shard_size));
+    for (int i = 0; i < 20; i++) {
+        const std::pair<int, int> start = RandomFreeNode(grid, random);
+        const std::vector<int> distance = Distances(grid, start);
+        for (int j = 0; j < 10; j++) {
+            const std::pair<int, int> goal = RandomFreeNode(grid, random);
+            CheckQuery(planner, grid, start, goal, distance[grid.ToIndex(goal)]);
+        }
+        CheckQuery(planner, grid, start, start, 0);
+    }
+    // Blocked and outside cells have no path
+    CheckQuery(planner, grid, {1, 1}, {0, 0}, -1);
+    CheckQuery(planner, grid, {1, 1}, {grid.get_length(), 1}, -1);
+    planner.Stop();
+    CHECK(planner.get_worker_count() == 0);
+    CHECK(SegmentsLeft() == 0);
+}
+
+} // namespace
+
+int main() {
+    MapOptions options;
+    options.length = 150;
+    options.width = 100;
+    options.seed = 7;
+    options.threads = 1;
+    BitGrid grid;
+    CHECK(MapGenerator(options).Generate(MapGenerator::kBraided, grid));
+    // A wall leaves cells on either side which cannot reach each other
+    for (int y = 0; y < grid.get_width(); y++)
+        grid.SetFree(100, y, false);
+    const std::string file = "/tmp/sharded_planner_test_" + std::to_string(getpid()) + ".tmap";
+    CHECK(TiledMap::Save(grid, file));
+    // Shards aligned on the tiles of the file or not, and a single shard
+    TestAgainstBfs(file, grid, 3, 32);
+    TestAgainstBfs(file, grid, 1, 17);
+    TestAgainstBfs(file, grid, 4, 150);
+    std::remove(file.c_str());
+    return TEST_RESULT();
+}
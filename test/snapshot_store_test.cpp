@@ -0,0 +1,140 @@
+/*
+ * @file        snapshot_store_test.cpp
+ * @author      Arun Kumar Devarajulu
+ * @author      Zuyang Cao
+ * @author      Qidi Xu
+ * @author      Hongyang Jiang
+ * @date        10/19/2026
+ * @brief       The file snapshot_store_test.cpp stresses the hazard pointers of SnapshotStore:
+ *              readers pin versions while a writer publishes and reclaims them
+ * @license     MIT License
+ *              Permission is hereby granted, free of charge, to any person obtaining a copy
+ *              of this software and associated documentation files (the "Software"), to deal
+ *              in the Software without restriction, including without limitation the rights
+ *              to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *              copies of the Software, and to permit persons to whom the Software is
+ *              furnished to do so, subject to the following conditions:
+ *
+ *              The above copyright notice and this permission notice shall be included in all
+ *              copies or substantial portions of the Software.
+ *
+ *              THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *              IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *              FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT. IN NO EVENT SHALL THE
+ *              AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *              LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *              OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *              SOFTWARE.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "../include/BitGrid.h"
+#include "../include/SnapshotStore.h"
+#include "TestCheck.h"
+
+namespace {
+
+/*! \brief Side of the row the writer edits */
+const int kLength = 256;
+
+/*! \brief Free cells of row 0 after a number of publications: the writer frees the
+ * cells left to right, then blocks them again, and so on */
+int ExpectedFree(const std::uint64_t &publications) {
+    const auto phase = static_cast<int>(publications % (2 * kLength));
+    return phase <= kLength ? phase : 2 * kLength - phase;
+}
+
+/*! \brief Edit of the writer for a publication numbered from 1 */
+ObstacleUpdate EditOf(const std::uint64_t &publication) {
+    const auto index = static_cast<int>((publication - 1) % kLength);
+    const bool is_free = ((publication - 1) / kLength) % 2 == 0;
+    return ObstacleUpdate{index, 0, is_free};
+}
+
+/*! \brief Free cells of row 0 of a version */
+int CountFree(const MapSnapshot &snapshot) {
+    int count = 0;
+    for (int x = 0; x < kLength; x++)
+        count += snapshot.get_grid().IsNotObstacle(std::make_pair(x, 0)) ? 1 : 0;
+    return count;
+}
+
+/*! \brief A pinned version survives publications and is reclaimed once released */
+void TestPinAndReclaim() {
+    SnapshotStore store(BitGrid(kLength, 2), 4);
+    {
+        SnapshotStore::Reader old_version(store);
+        CHECK(old_version->get_version() == 1);
+        store.Submit(EditOf(1));
+        CHECK(store.Publish() == 2);
+        store.Submit(EditOf(2));
+        CHECK(store.Publish() == 3);
+        // Version 2 is not pinned and goes at once, version 1 stays for the reader
+        CHECK(store.get_retired_count() == 1);
+        CHECK(CountFree(*old_version) == 0);
+        SnapshotStore::Reader new_version(store);
+        CHECK(new_version->get_version() == 3);
+        CHECK(CountFree(*new_version) == 2);
+    }
+    // Publishing without any change still reclaims
+    CHECK(store.Publish() == 3);
+    CHECK(store.get_retired_count() == 0);
+}
+
+/*! \brief Readers, more than the slots, pin and read while a writer publishes */
+void TestStress() {
+    const std::uint64_t publications = 3000;
+    const int readers = 6;
+    SnapshotStore store(BitGrid(kLength, 2), 3);
+    std::atomic<bool> is_stopping{false};
+    std::atomic<int> errors{0};
+    std::atomic<long> reads{0};
+    std::vector<std::thread> threads;
+    for (int reader = 0; reader < readers; reader++) {
+        threads.emplace_back([&store, &is_stopping, &errors, &reads]() {
+            std::uint64_t last = 0;
+            while (!is_stopping.load()) {
+                SnapshotStore::Reader snapshot(store);
+                const std::uint64_t version = snapshot->get_version();
+                if (version < last)
+                    errors++;
+                last = version;
+                // Read twice, the second time after other threads had a chance to
+                // publish and reclaim, to catch a version freed while pinned
+                const int free = CountFree(*snapshot);
+                std::this_thread::yield();
+                if (free != ExpectedFree(version - 1) || CountFree(*snapshot) != free)
+                    errors++;
+                reads++;
+            }
+        });
+    }
+    // Readers are reading before the writer starts, even on a single CPU
+    while (reads.load() < readers)
+        std::this_thread::yield();
+    for (std::uint64_t publication = 1; publication <= publications; publication++) {
+        store.Submit(EditOf(publication));
+        store.Publish();
+        std::this_thread::yield();
+    }
+    is_stopping.store(true);
+    for (auto &thread : threads)
+        thread.join();
+    CHECK(errors.load() == 0);
+    CHECK(reads.load() > 0);
+    CHECK(store.get_version() == publications + 1);
+    store.Publish();
+    CHECK(store.get_retired_count() == 0);
+}
+
+}  // namespace
+
+int main() {
+    TestPinAndReclaim();
+    TestStress();
+    return TEST_RESULT();
+}